@@ -81,6 +81,18 @@ class stats( Gaffer.Application ) :
 			```
 			gaffer stats fileName.gfr -image NameOfNode -performanceMonitor
 			```
+
+			To find which nodes are responsible for the memory used by a scene :
+
+			```
+			gaffer stats fileName.gfr -scene NameOfNode -memoryMonitor
+			```
+
+			To record a timeline of a task's processes for viewing in Perfetto :
+
+			```
+			gaffer stats fileName.gfr -task NameOfNode -traceFile trace.json
+			```
 			"""
 		)
 
@@ -200,7 +212,7 @@ class stats( Gaffer.Application ) :
 				IECore.IntParameter(
 					name = "maxLinesPerMetric",
 					description = "The maximum number of plugs to list for each metric "
-						"captured by the performance monitor.",
+						"captured by the performance and memory monitors.",
 					defaultValue = 50,
 				),
 
@@ -211,6 +223,13 @@ class stats( Gaffer.Application ) :
 					defaultValue = False,
 				),
 
+				IECore.BoolParameter(
+					name = "memoryMonitor",
+					description = "Turns on a memory monitor to attribute the memory "
+						"used by computes and caches to individual plugs.",
+					defaultValue = False,
+				),
+
 				IECore.StringParameter(
 					name = "contextMonitorRoot",
 					description = "The name of a node or plug to provide a root for the "
@@ -222,12 +241,23 @@ class stats( Gaffer.Application ) :
 				IECore.FileNameParameter(
 					name = "annotatedScript",
 					description = "Filename used to save a copy of the script containing "
-						"annotations from the performance and Context monitors.",
+						"annotations from the performance, Context and memory monitors.",
 					defaultValue = "",
 					allowEmptyString = True,
 					extensions = "gfr",
 				),
 
+				IECore.FileNameParameter(
+					name = "traceFile",
+					description = "Records a timeline of every process, and writes it to "
+						"this file in Chrome's trace event format. This can be loaded into "
+						"Perfetto (https://ui.perfetto.dev) to identify critical paths, "
+						"serialisation points and idle threads.",
+					defaultValue = "",
+					allowEmptyString = True,
+					extensions = "json",
+				),
+
 				IECore.BoolParameter(
 					name = "vtune",
 					description = "Enables VTune instrumentation. When enabled, the VTune "
@@ -324,6 +354,16 @@ class stats( Gaffer.Application ) :
 		else :
 			self.__contextMonitor = None
 
+		if args["memoryMonitor"].value :
+			self.__memoryMonitor = Gaffer.MemoryMonitor()
+		else :
+			self.__memoryMonitor = None
+
+		if args["traceFile"].value :
+			self.__traceMonitor = Gaffer.TraceMonitor()
+		else :
+			self.__traceMonitor = None
+
 		if args["vtune"].value :
 			try:
 				self.__vtuneMonitor = Gaffer.VTuneMonitor()
@@ -372,7 +412,7 @@ class stats( Gaffer.Application ) :
 
 		self.__output.write( "\n" )
 
-		self.__writeMemory()
+		self.__writeMemory( args )
 
 		self.__output.write( "\n" )
 
@@ -386,6 +426,9 @@ class stats( Gaffer.Application ) :
 
 		self.__output.close()
 
+		if self.__traceMonitor is not None :
+			self.__traceMonitor.writeChromeTrace( args["traceFile"].value )
+
 		if args["annotatedScript"].value :
 
 			if self.__performanceMonitor is not None :
@@ -394,6 +437,9 @@ class stats( Gaffer.Application ) :
 				Gaffer.MonitorAlgo.annotate( script, self.__performanceMonitor, Gaffer.MonitorAlgo.PerformanceMetric.ComputeCount )
 			if self.__contextMonitor is not None :
 				Gaffer.MonitorAlgo.annotate( script, self.__contextMonitor )
+			if self.__memoryMonitor is not None :
+				Gaffer.MonitorAlgo.annotate( script, self.__memoryMonitor, Gaffer.MonitorAlgo.MemoryMetric.ComputeCacheMemory )
+				Gaffer.MonitorAlgo.annotate( script, self.__memoryMonitor, Gaffer.MonitorAlgo.MemoryMetric.PeakComputeMemory )
 
 			script.serialiseToFile( args["annotatedScript"].value )
 
@@ -507,7 +553,7 @@ class stats( Gaffer.Application ) :
 		memory = _Memory.maxRSS()
 		# We don't expect serialisation to trigger any processes that the monitors would see,
 		# but we definitely want to know if they do.
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__memoryMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 			with _Timer() as timer :
 				script.serialise()
 
@@ -563,7 +609,7 @@ class stats( Gaffer.Application ) :
 			computeScene()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__memoryMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as sceneTimer :
 					computeScene()
@@ -605,7 +651,7 @@ class stats( Gaffer.Application ) :
 			computeImage()
 
 		memory = _Memory.maxRSS()
-		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+		with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__memoryMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 			with contextSanitiser :
 				with _Timer() as imageTimer :
 					computeImage()
@@ -641,7 +687,7 @@ class stats( Gaffer.Application ) :
 
 		memory = _Memory.maxRSS()
 		with _Timer() as taskTimer :
-			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
+			with self.__performanceMonitor or contextlib.nullcontext(), self.__contextMonitor or contextlib.nullcontext(), self.__memoryMonitor or contextlib.nullcontext(), self.__traceMonitor or contextlib.nullcontext(), self.__vtuneMonitor or contextlib.nullcontext() :
 				with self.__context( script, args ) as context :
 					for frame in self.__frames( script, args ) :
 						context.setFrame( frame )
@@ -650,7 +696,7 @@ class stats( Gaffer.Application ) :
 		self.__timers["Task execution"] = taskTimer
 		self.__memory["Task execution"] = _Memory.maxRSS() - memory
 
-	def __writeMemory( self ) :
+	def __writeMemory( self, args ) :
 
 		objectPool = IECore.ObjectPool.defaultObjectPool()
 
@@ -681,6 +727,14 @@ class stats( Gaffer.Application ) :
 		self.__output.write( "Memory :\n\n" )
 		self.__writeItems( items )
 
+		if self.__memoryMonitor is not None :
+			self.__output.write(
+				"\n" + Gaffer.MonitorAlgo.formatStatistics(
+					self.__memoryMonitor,
+					maxLinesPerMetric = args["maxLinesPerMetric"].value
+				)
+			)
+
 	def __writeStatisticsItems( self, script, stats, key, n ) :
 
 		stats.sort( key = key, reverse = True )
@@ -83,6 +83,11 @@ class GAFFER_API ComputeNode : public DependencyNode
 		/// Called to determine how calls to `compute()` should be cached. If `compute( output )`
 		/// will spawn TBB tasks then one of the task-based policies _must_ be used.
 		virtual ValuePlug::CachePolicy computeCachePolicy( const ValuePlug *output ) const;
+		/// Called to determine which cache partition the results of `compute( output )`
+		/// should be stored in. The default implementation returns "", which is the
+		/// name of the default partition. See `ValuePlug::setCachePartitionMemoryLimit()`
+		/// for more details.
+		virtual IECore::InternedString computeCachePartition( const ValuePlug *output ) const;
 
 	private :
 
@@ -47,6 +47,7 @@
 #include "IECore/StringAlgo.h"
 
 #include "boost/container/flat_map.hpp"
+#include "boost/container/small_vector.hpp"
 
 namespace Gaffer
 {
@@ -102,6 +103,9 @@ class GAFFER_API Context : public IECore::RefCounted
 
 		/// Returns a reference to the value of a variable, throwing if it doesn't exist or
 		/// has the wrong type : `float f = context->get<float>( "myFloat" )`.
+		/// \note References to small values such as ints, floats and short vectors
+		/// (and the pointers returned by `getIfExists()`) remain valid when the
+		/// variable is set again, and may then refer to the new value.
 		template<typename T>
 		const T &get( const IECore::InternedString &name ) const;
 		/// As above, but returns `defaultValue` if the variable doesn't exist.
@@ -325,6 +329,12 @@ class GAFFER_API Context : public IECore::RefCounted
 
 			IECore::DataPtr makeData() const;
 			Value copy( IECore::ConstDataPtr &owner ) const;
+			// Returns true if values of the specified type may be
+			// copied into an `InlineSlot` using `copyInline()`.
+			static bool inlineable( IECore::TypeId typeId );
+			// Copies the value into `storage`, returning a Value that
+			// references it.
+			Value copyInline( void *storage ) const;
 
 			// Throws if the `hash()` no longer corresponds to `value()`.
 			// This can occur if the pointee is modified after calling
@@ -336,8 +346,13 @@ class GAFFER_API Context : public IECore::RefCounted
 
 			private :
 
+				friend class Context;
+
 				Value( IECore::TypeId typeId, const void *value, const IECore::MurmurHash &hash );
 
+				template<typename T>
+				static IECore::MurmurHash computeHash( const IECore::InternedString &name, IECore::TypeId typeId, const T &value );
+
 				IECore::TypeId m_typeId;
 				const void *m_value;
 				IECore::MurmurHash m_hash;
@@ -349,6 +364,8 @@ class GAFFER_API Context : public IECore::RefCounted
 					Value (*constructor)( const IECore::InternedString &name, const IECore::Data *data );
 					const void *(*valueFromData)( const IECore::Data *data );
 					void (*validate)( const IECore::InternedString &name, const Value &v );
+					// Null for types that can't be stored inline.
+					void (*copyInline)( const void *value, void *storage );
 				};
 
 				using TypeMap = boost::container::flat_map<IECore::TypeId, TypeFunctions>;
@@ -363,6 +380,12 @@ class GAFFER_API Context : public IECore::RefCounted
 		void internalSet( const IECore::InternedString &name, const Value &value );
 		// Sets a variable and maintains ownership of its data via `owner`.
 		void internalSetWithOwner( const IECore::InternedString &name, const Value &value, IECore::ConstDataPtr &&owner );
+		// Sets a variable to a copy of `value`, stored in an InlineSlot
+		// rather than in separately allocated data. `copy( storage )`
+		// must copy `value` into `storage`, returning a Value that
+		// references it.
+		template<typename CopyFunction>
+		void internalSetInline( const IECore::InternedString &name, const Value &value, CopyFunction &&copy );
 		// Throws if variable doesn't exist.
 		const Value &internalGet( const IECore::InternedString &name ) const;
 		// Returns nullptr if variable doesn't exist.
@@ -383,6 +406,42 @@ class GAFFER_API Context : public IECore::RefCounted
 		using AllocMap = boost::container::flat_map<IECore::InternedString, IECore::ConstDataPtr>;
 		AllocMap m_allocMap;
 
+		// Storage for values of types where `Detail::IsInlineable` is true,
+		// avoiding the allocation of a separate `IECore::Data` for each.
+		// Slots are allocated in blocks which are never moved, so that
+		// references to values remain valid as other variables are added.
+		// Owning copies share the blocks of the source context, and slots
+		// are only written to while their block is owned exclusively.
+		union InlineSlot
+		{
+			alignas( void * ) unsigned char storage[16];
+			// Used to link slots that are no longer in use.
+			InlineSlot *nextFree;
+		};
+
+		struct InlineBlock : public IECore::RefCounted
+		{
+			IE_CORE_DECLAREMEMBERPTR( InlineBlock );
+			static constexpr size_t size = 8;
+			InlineSlot slots[size];
+			size_t numUsed = 0;
+		};
+
+		// Returns the slot referenced by `value`, or null if
+		// it doesn't reference a slot in one of our blocks.
+		const InlineSlot *inlineSlot( const Value &value ) const;
+		// As above, but also returns null if the block is shared
+		// with another context.
+		InlineSlot *writableInlineSlot( const Value &value );
+		InlineSlot *acquireInlineSlot();
+		// Makes the slot referenced by `value` available for reuse,
+		// if it is writable.
+		void releaseInlineSlot( const Value &value );
+
+		using InlineBlocks = boost::container::small_vector<InlineBlock::Ptr, 1>;
+		InlineBlocks m_inlineBlocks;
+		InlineSlot *m_freeInlineSlots;
+
 };
 
 IE_CORE_DECLAREPTR( Context );
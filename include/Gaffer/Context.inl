@@ -40,6 +40,9 @@
 
 #include "fmt/format.h"
 
+#include <new>
+#include <type_traits>
+
 namespace Gaffer
 {
 
@@ -98,6 +101,54 @@ struct DataTraits<std::vector<Imath::Vec3<T> > >
 
 };
 
+// Class to dictate which types may be stored in a
+// `Context::InlineSlot`, avoiding the allocation of
+// a separate `IECore::Data` to hold them. Types must be
+// small enough to fit in `InlineSlot::storage` and must
+// not need destroying, because destructors are never
+// run for the slots.
+template<typename T, typename Enabler = void>
+struct IsInlineable : std::false_type
+{
+};
+
+template<typename T>
+struct IsInlineable<T, std::enable_if_t<std::is_arithmetic_v<T>>> : std::true_type
+{
+};
+
+template<typename T>
+struct IsInlineable<Imath::Vec2<T>, std::enable_if_t<sizeof( Imath::Vec2<T> ) <= 16>> : std::true_type
+{
+};
+
+template<typename T>
+struct IsInlineable<Imath::Vec3<T>, std::enable_if_t<sizeof( Imath::Vec3<T> ) <= 16>> : std::true_type
+{
+};
+
+template<typename T>
+struct IsInlineable<Imath::Color3<T>, std::enable_if_t<sizeof( Imath::Color3<T> ) <= 16>> : std::true_type
+{
+};
+
+template<typename T>
+struct IsInlineable<Imath::Color4<T>, std::enable_if_t<sizeof( Imath::Color4<T> ) <= 16>> : std::true_type
+{
+};
+
+template<typename T>
+struct IsInlineable<Imath::Box<Imath::Vec2<T>>, std::enable_if_t<sizeof( Imath::Box<Imath::Vec2<T>> ) <= 16>> : std::true_type
+{
+};
+
+// InternedString isn't trivially destructible, but its destructor
+// does nothing because interned strings are never freed.
+template<>
+struct IsInlineable<IECore::InternedString> : std::true_type
+{
+};
+
 } // namespace Detail
 
 inline Context::Value::Value()
@@ -108,19 +159,27 @@ inline Context::Value::Value()
 template<typename T>
 Context::Value::Value( const IECore::InternedString &name, const T *value )
 	:	m_typeId( Detail::DataTraits<T>::DataType::staticTypeId() ),
-		m_value( value )
+		m_value( value ),
+		m_hash( computeHash( name, m_typeId, *value ) )
+{
+}
+
+template<typename T>
+IECore::MurmurHash Context::Value::computeHash( const IECore::InternedString &name, IECore::TypeId typeId, const T &value )
 {
 	const std::string &nameStr = name.string();
 	if( nameStr.size() > 2 && nameStr[0] == 'u' && nameStr[1] == 'i' && nameStr[2] == ':' )
 	{
-		m_hash = IECore::MurmurHash( 0, 0 );
-	}
-	else
-	{
-		m_hash.append( *value );
-		m_hash.append( m_typeId );
-		m_hash.append( (uint64_t)&nameStr );
+		return IECore::MurmurHash( 0, 0 );
 	}
+
+	// Names are interned, so we can hash the address of the
+	// string rather than the string itself.
+	IECore::MurmurHash result;
+	result.append( value );
+	result.append( typeId );
+	result.append( (uint64_t)&nameStr );
+	return result;
 }
 
 template<typename T>
@@ -129,7 +188,7 @@ inline const T &Context::Value::value() const
 	using DataType = typename Gaffer::Detail::DataTraits<T>::DataType;
 	if( m_typeId == DataType::staticTypeId() )
 	{
-		return *static_cast<const T *>( m_value );
+		return *static_cast<const T *>( rawValue() );
 	}
 	throw IECore::Exception( fmt::format( "Context variable is not of type \"{}\"", DataType::staticTypeName() ) );
 }
@@ -166,16 +225,42 @@ void Context::Value::registerType()
 			);
 		}
 	};
+	if constexpr( Detail::IsInlineable<ValueType>::value )
+	{
+		static_assert( sizeof( ValueType ) <= sizeof( InlineSlot::storage ) && alignof( ValueType ) <= alignof( InlineSlot ) );
+		static_assert( std::is_trivially_destructible_v<ValueType> || std::is_same_v<ValueType, IECore::InternedString> );
+		functions.copyInline = [] ( const void *value, void *storage ) {
+			new( storage ) ValueType( *static_cast<const ValueType *>( value ) );
+		};
+	}
+	else
+	{
+		functions.copyInline = nullptr;
+	}
 }
 
 template<typename T, typename Enabler>
 void Context::set( const IECore::InternedString &name, const T &value )
 {
-	using DataType = typename Gaffer::Detail::DataTraits<T>::DataType;
-	typename DataType::ConstPtr d = new DataType( value );
-	const Value v( name, &d->readable() );
-	internalSetWithOwner( name, v, std::move( d ) );
-
+	if constexpr( Detail::IsInlineable<T>::value )
+	{
+		// Small values are stored in an InlineSlot, avoiding
+		// the allocation of a separate `Data` to own them.
+		const Value v( name, &value );
+		internalSetInline(
+			name, v,
+			[&] ( void *storage ) {
+				return Value( v.m_typeId, new( storage ) T( value ), v.m_hash );
+			}
+		);
+	}
+	else
+	{
+		using DataType = typename Gaffer::Detail::DataTraits<T>::DataType;
+		typename DataType::ConstPtr d = new DataType( value );
+		const Value v( name, &d->readable() );
+		internalSetWithOwner( name, v, std::move( d ) );
+	}
 }
 
 inline void Context::internalSet( const IECore::InternedString &name, const Value &value )
@@ -185,7 +270,12 @@ inline void Context::internalSet( const IECore::InternedString &name, const Valu
 		// Fast path, typically in an EditableScope, where we
 		// expect the value to have changed and don't want the
 		// expense of checking.
-		m_map[name] = value;
+		Value &v = m_map[name];
+		if( !m_inlineBlocks.empty() && v.rawValue() != value.rawValue() )
+		{
+			releaseInlineSlot( v );
+		}
+		v = value;
 		m_hashValid = false;
 	}
 	else
@@ -194,6 +284,10 @@ inline void Context::internalSet( const IECore::InternedString &name, const Valu
 		// `m_allocMap` already (removing the previous value).
 		Value &v = m_map[name];
 		const bool changed = v != value;
+		if( !m_inlineBlocks.empty() && v.rawValue() != value.rawValue() )
+		{
+			releaseInlineSlot( v );
+		}
 		v = value;
 		if( changed )
 		{
@@ -218,6 +312,103 @@ inline void Context::internalSetWithOwner( const IECore::InternedString &name, c
 	internalSet( name, value );
 }
 
+template<typename CopyFunction>
+void Context::internalSetInline( const IECore::InternedString &name, const Value &value, CopyFunction &&copy )
+{
+	Value &v = m_map[name];
+	// Compare before copying, because we may reuse the slot for
+	// the current value.
+	const bool changed = !m_changedSignal || v != value;
+
+	InlineSlot *slot = writableInlineSlot( v );
+	if( !slot )
+	{
+		slot = acquireInlineSlot();
+	}
+	v = copy( slot->storage );
+
+	// Any previous owner is no longer needed.
+	if( !m_allocMap.empty() )
+	{
+		AllocMap::iterator it = m_allocMap.find( name );
+		if( it != m_allocMap.end() )
+		{
+			m_allocMap.erase( it );
+		}
+	}
+
+	if( changed )
+	{
+		m_hashValid = false;
+		if( m_changedSignal )
+		{
+			(*m_changedSignal)( this, name );
+		}
+	}
+}
+
+inline const Context::InlineSlot *Context::inlineSlot( const Value &value ) const
+{
+	const InlineSlot *slot = static_cast<const InlineSlot *>( value.rawValue() );
+	for( const auto &block : m_inlineBlocks )
+	{
+		if( slot >= block->slots && slot < block->slots + InlineBlock::size )
+		{
+			return slot;
+		}
+	}
+	return nullptr;
+}
+
+inline Context::InlineSlot *Context::writableInlineSlot( const Value &value )
+{
+	const InlineSlot *slot = static_cast<const InlineSlot *>( value.rawValue() );
+	for( const auto &block : m_inlineBlocks )
+	{
+		if( slot >= block->slots && slot < block->slots + InlineBlock::size )
+		{
+			// If the block is shared, another context may be referencing
+			// the slot, so we must leave it alone.
+			return block->refCount() == 1 ? const_cast<InlineSlot *>( slot ) : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+inline Context::InlineSlot *Context::acquireInlineSlot()
+{
+	if( m_freeInlineSlots )
+	{
+		// Only slots from exclusively owned blocks are ever freed, and
+		// other contexts sharing the block since then can't be referencing
+		// them, so the free list is always safe to use.
+		InlineSlot *result = m_freeInlineSlots;
+		m_freeInlineSlots = result->nextFree;
+		return result;
+	}
+
+	if(
+		m_inlineBlocks.empty() ||
+		m_inlineBlocks.back()->numUsed == InlineBlock::size ||
+		m_inlineBlocks.back()->refCount() != 1
+	)
+	{
+		m_inlineBlocks.push_back( new InlineBlock );
+	}
+
+	InlineBlock *block = m_inlineBlocks.back().get();
+	return &block->slots[block->numUsed++];
+}
+
+inline void Context::releaseInlineSlot( const Value &value )
+{
+	if( InlineSlot *slot = writableInlineSlot( value ) )
+	{
+		slot->nextFree = m_freeInlineSlots;
+		m_freeInlineSlots = slot;
+	}
+}
+
 inline const Context::Value &Context::internalGet( const IECore::InternedString &name ) const
 {
 	const Value *result = internalGetIfExists( name );
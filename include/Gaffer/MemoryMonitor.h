@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/RefCounted.h"
+
+#include "boost/unordered_map.hpp"
+#include "boost/unordered_set.hpp"
+
+#include "tbb/enumerable_thread_specific.h"
+#include "tbb/spin_mutex.h"
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which attributes memory usage to the plugs responsible
+/// for it. Records the memory used by the results of compute processes,
+/// and determines how much of that memory remains resident in the
+/// compute cache, along with the number of hash cache entries held
+/// for each plug. Memory usage is measured by calling `memoryUsage()`
+/// on each new result, which can be costly for some types.
+///
+/// > Note : Compute cache residency is determined at the time statistics
+/// > are queried. Hash caches are private to each thread, so residency in
+/// > them is determined by each thread as it runs processes, and may
+/// > include entries evicted since. Cache entries shared between several
+/// > plugs are attributed to each of them. Hash cache residency is not
+/// > reported when using `ValuePlug::HashCacheMode::Legacy`.
+class GAFFER_API MemoryMonitor : public Monitor
+{
+
+	public :
+
+		MemoryMonitor();
+		~MemoryMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( MemoryMonitor )
+
+		struct GAFFER_API Statistics
+		{
+
+			Statistics(
+				size_t computeCount = 0,
+				size_t computeMemory = 0,
+				size_t peakComputeMemory = 0,
+				size_t computeCacheMemory = 0,
+				size_t hashCacheEntries = 0
+			);
+
+			/// The number of successful compute processes.
+			size_t computeCount;
+			/// The total memory used by the results of all compute processes,
+			/// as measured by `IECore::Object::memoryUsage()`.
+			size_t computeMemory;
+			/// The memory used by the largest single result.
+			size_t peakComputeMemory;
+			/// The memory used by results that are currently resident in
+			/// the compute cache.
+			size_t computeCacheMemory;
+			/// The number of hashes currently resident in the hash cache.
+			size_t hashCacheEntries;
+
+			/// Sums all values other than `peakComputeMemory`, for which
+			/// the maximum is taken.
+			Statistics & operator += ( const Statistics &rhs );
+
+			bool operator == ( const Statistics &rhs );
+			bool operator != ( const Statistics &rhs );
+
+		};
+
+		using StatisticsMap = boost::unordered_map<ConstPlugPtr, Statistics>;
+
+		const StatisticsMap &allStatistics() const;
+		const Statistics &plugStatistics( const Plug *plug ) const;
+		const Statistics &combinedStatistics() const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+
+	private :
+
+		// Everything a single thread knows about the results for a
+		// single plug.
+		struct PlugData
+		{
+			// Accumulated by `processFinished()`. The cache residency
+			// members are filled in by `collate()`.
+			Statistics statistics;
+			// Maps from compute cache keys to memory usage.
+			using ComputeCacheKeys = boost::unordered_map<IECore::MurmurHash, size_t>;
+			ComputeCacheKeys computeCacheKeys;
+			// Context hash and dirty count for each hash cache key.
+			using HashCacheKeys = boost::unordered_set<std::pair<IECore::MurmurHash, uint64_t>>;
+			HashCacheKeys hashCacheKeys;
+			// Keys added since the last call to `prune()`. These can't
+			// be checked for residency yet, because processes finish
+			// before their results are stored in the caches.
+			ComputeCacheKeys recentComputeCacheKeys;
+			HashCacheKeys recentHashCacheKeys;
+		};
+
+		using PlugDataMap = boost::unordered_map<ConstPlugPtr, PlugData>;
+
+		// For performance reasons we accumulate our data into
+		// thread local storage while computations are running.
+		struct ThreadData
+		{
+			// Protects `plugData`. Only contended while `collate()`
+			// is running.
+			tbb::spin_mutex mutex;
+			PlugDataMap plugData;
+			size_t numKeys = 0;
+			size_t numRecentKeys = 0;
+		};
+
+		mutable tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
+
+		// Discards keys which are no longer resident in the caches,
+		// so that our memory usage is bounded by the size of the
+		// caches. Must be called with `threadData.mutex` locked, and
+		// on the thread that owns `threadData`, because only that thread
+		// can query its hash cache. Recent keys are only checked if
+		// `checkRecent` is true.
+		static void prune( ThreadData &threadData, bool checkRecent );
+
+		// Then when we want to query it, we collate it into
+		// m_statistics.
+		void collate() const;
+		mutable StatisticsMap m_statistics;
+		mutable Statistics m_combinedStatistics;
+
+};
+
+IE_CORE_DECLAREPTR( MemoryMonitor )
+
+} // namespace Gaffer
@@ -44,6 +44,7 @@ namespace Gaffer
 {
 
 class ContextMonitor;
+class MemoryMonitor;
 class Node;
 class PerformanceMonitor;
 
@@ -66,15 +67,32 @@ enum PerformanceMetric
 	Last = HashesPerCompute
 };
 
+enum class MemoryMetric
+{
+	Invalid,
+	ComputeCacheMemory,
+	HashCacheEntries,
+	ComputeMemory,
+	PeakComputeMemory,
+
+	First = ComputeCacheMemory,
+	Last = PeakComputeMemory
+};
+
 GAFFER_API std::string formatStatistics( const PerformanceMonitor &monitor, size_t maxLinesPerMetric = 50 );
 GAFFER_API std::string formatStatistics( const PerformanceMonitor &monitor, PerformanceMetric metric, size_t maxLines = 50 );
+GAFFER_API std::string formatStatistics( const MemoryMonitor &monitor, size_t maxLinesPerMetric = 50 );
+GAFFER_API std::string formatStatistics( const MemoryMonitor &monitor, MemoryMetric metric, size_t maxLines = 50 );
 
 GAFFER_API void annotate( Node &root, const PerformanceMonitor &monitor, bool persistent = true );
 GAFFER_API void annotate( Node &root, const PerformanceMonitor &monitor, PerformanceMetric metric, bool persistent = true );
 GAFFER_API void annotate( Node &root, const ContextMonitor &monitor, bool persistent = true );
+GAFFER_API void annotate( Node &root, const MemoryMonitor &monitor, bool persistent = true );
+GAFFER_API void annotate( Node &root, const MemoryMonitor &monitor, MemoryMetric metric, bool persistent = true );
 
 GAFFER_API void removePerformanceAnnotations( Node &root );
 GAFFER_API void removeContextAnnotations( Node &root );
+GAFFER_API void removeMemoryAnnotations( Node &root );
 
 } // namespace MonitorAlgo
 
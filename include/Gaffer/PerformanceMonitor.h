@@ -59,9 +59,17 @@ class GAFFER_API PerformanceMonitor : public Monitor
 
 	public :
 
-		PerformanceMonitor();
+		/// If `sampleInterval` is greater than 1, then only a random
+		/// sample of approximately one in every `sampleInterval` processes
+		/// is measured, significantly reducing the overhead of monitoring.
+		/// Counts and durations are then scaled by `sampleInterval` to give
+		/// estimates of the true statistics. Time spent in processes that
+		/// are not sampled is not billed to their parent processes.
+		PerformanceMonitor( size_t sampleInterval = 1 );
 		~PerformanceMonitor() override;
 
+		size_t sampleInterval() const;
+
 		IE_CORE_DECLAREMEMBERPTR( PerformanceMonitor )
 
 		struct GAFFER_API Statistics
@@ -104,17 +112,26 @@ class GAFFER_API PerformanceMonitor : public Monitor
 		// thread local storage while computations are running.
 		struct ThreadData
 		{
+			ThreadData();
 			// Stores the per-plug statistics captured by this thread.
 			StatisticsMap statistics;
 			// Stack of durations pointing into the statistics map.
 			// The top of the stack is the duration we're billing the
-			// current chunk of time to.
+			// current chunk of time to. Processes that are not sampled
+			// are represented by null entries, and time spent in them
+			// is not billed to anything.
 			using DurationStack = std::stack<boost::chrono::nanoseconds *>;
 			DurationStack durationStack;
 			// The last time measurement we made.
 			boost::chrono::high_resolution_clock::time_point then;
+			// State for the random number generator used for sampling.
+			uint32_t randomState;
 		};
 
+		bool sample( ThreadData &threadData ) const;
+
+		const size_t m_sampleInterval;
+
 		tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
 
 		// Then when we want to query it, we collate it into m_statistics.
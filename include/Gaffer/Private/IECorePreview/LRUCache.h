@@ -40,6 +40,9 @@
 #include "boost/noncopyable.hpp"
 #include "boost/variant.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <optional>
 
 namespace IECorePreview
@@ -92,6 +95,11 @@ class TaskParallel;
 /// in addition to the Key. It must be implicitly castable to Key, and all GetterKeys
 /// which yield the same Key must also yield the same results from the GetterFunction.
 ///
+/// By default, items are evicted in approximately least-recently-used order, without
+/// regard to how expensive they were to compute. The CostAware EvictionMode instead
+/// approximates the GreedyDual-Size algorithm, preferentially retaining items which
+/// took a long time to compute relative to their cost.
+///
 /// \ingroup utilityGroup
 template<typename Key, typename Value, template <typename> class Policy=LRUCachePolicy::Parallel, typename GetterKey=Key>
 class LRUCache : private boost::noncopyable
@@ -101,6 +109,18 @@ class LRUCache : private boost::noncopyable
 		using Cost = size_t;
 		using KeyType = Key;
 
+		enum class EvictionMode
+		{
+			/// Evicts the least recently used items first.
+			LRU,
+			/// Gives items additional chances to survive eviction in
+			/// proportion to the logarithm of their compute time per
+			/// unit cost. Compute time is measured automatically for
+			/// `get()`, and must be provided explicitly to `set()` and
+			/// `setIfUncached()`.
+			CostAware
+		};
+
 		/// The GetterFunction is responsible for computing the value and cost for a cache entry
 		/// when given the key. It should throw a descriptive exception if it can't get the data for
 		/// any reason. Cancellation support requires that `IECore::Canceller::check( canceller )`
@@ -129,15 +149,17 @@ class LRUCache : private boost::noncopyable
 		/// Returns true for success and false on failure - failure can occur
 		/// if the cost exceeds the maximum cost for the cache. Note that even
 		/// when true is returned, the item may be removed from the cache by a
-		/// subsequent (or concurrent) operation.
-		bool set( const Key &key, const Value &value, Cost cost );
+		/// subsequent (or concurrent) operation. The optional `computeDuration`
+		/// is the time taken to compute the value, and is used by the CostAware
+		/// EvictionMode.
+		bool set( const Key &key, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 ) );
 		/// As above, but only if the item is not cached already. This avoids
 		/// calling a potentially expensive cost function in the case that the
 		/// item is cached already.
 		/// \todo Ideally we wouldn't need the cost calculation to be duplicated
 		/// between CostFunction and GetterFunction.
 		template<typename CostFunction>
-		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction );
+		bool setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 ) );
 
 		/// Returns true if the object is in the cache. Note that the
 		/// return value may be invalidated immediately by operations performed
@@ -163,6 +185,45 @@ class LRUCache : private boost::noncopyable
 		/// Returns the current cost of all cached items.
 		Cost currentCost() const;
 
+		/// Sets the EvictionMode. Items already in the cache retain the
+		/// priority they were given when added.
+		void setEvictionMode( EvictionMode evictionMode );
+		EvictionMode getEvictionMode() const;
+
+		/// Statistics describing the effectiveness of the cache. Hits and
+		/// misses count individual lookups via `get()` and `getIfCached()`,
+		/// so a client that looks up the same key more than once will be
+		/// counted more than once. Counters are distributed internally to
+		/// avoid contention, so totals are only approximate while other
+		/// threads are using the cache.
+		struct Statistics
+		{
+			uint64_t hits = 0;
+			uint64_t misses = 0;
+			/// Number of items discarded to remain within the maximum cost.
+			/// Items removed by `erase()` and `clear()` are not counted.
+			uint64_t evictions = 0;
+			/// The total cost of the evicted items.
+			uint64_t evictedCost = 0;
+			/// Total time spent in the GetterFunction, plus the durations
+			/// passed to `set()` and `setIfUncached()`. This includes any
+			/// time spent in nested calls to the cache made by the getter.
+			/// The GetterFunction is only timed when the CostAware
+			/// EvictionMode is active, since that is the only mode to need
+			/// the duration.
+			std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 );
+			/// Number of times a thread found an item locked by another
+			/// thread, and had to wait or collaborate before retrying. Always
+			/// zero for the Serial policy.
+			uint64_t contentionWaits = 0;
+		};
+
+		/// Returns the statistics accumulated since construction or
+		/// the last call to `resetStatistics()`.
+		Statistics statistics() const;
+		/// Resets all statistics to zero.
+		void resetStatistics();
+
 	private :
 
 		// Data
@@ -198,24 +259,78 @@ class LRUCache : private boost::noncopyable
 
 			State state;
 			Cost cost; // the cost for this item
+			// The number of additional chances this item gets to
+			// survive eviction, as determined by the EvictionMode.
+			uint8_t retention;
 
 			Status status() const;
 
 		};
 
+		// A single statistic, safe to update concurrently from
+		// any number of threads. Used by the threadsafe policies.
+		struct AtomicCounter
+		{
+			AtomicCounter();
+			void add( uint64_t value );
+			uint64_t get() const;
+			void reset();
+			std::atomic<uint64_t> m_value;
+		};
+
+		// A single statistic, updated only by the one thread using
+		// a Serial cache, but safe to read and reset from others.
+		// This avoids the cost of an atomic read-modify-write on
+		// every lookup.
+		struct SingleWriterCounter
+		{
+			SingleWriterCounter();
+			void add( uint64_t value );
+			uint64_t get() const;
+			void reset();
+			std::atomic<uint64_t> m_value;
+			// Value at the last reset. Storing this separately means
+			// that a reset never races with the owning thread's updates.
+			std::atomic<uint64_t> m_baseline;
+		};
+
+		// Counters used to accumulate Statistics. These are
+		// owned by the Policy, so that it can distribute them
+		// in the same way as the items themselves, avoiding
+		// contention between threads. The Policy also chooses
+		// the Counter type according to its threading model.
+		template<typename Counter>
+		struct Counters
+		{
+			Counter hits;
+			Counter misses;
+			Counter evictions;
+			Counter evictedCost;
+			Counter computeDuration;
+			Counter contentionWaits;
+
+			void accumulate( Statistics &statistics ) const;
+			void reset();
+		};
+
 		// Policy. This is responsible for
 		// the internal storage for the cache.
 		Policy<LRUCache> m_policy;
 
 		Cost m_maxCost;
 		bool m_cacheErrors;
+		std::atomic<EvictionMode> m_evictionMode;
 
 		// Methods
 		// =======
 
 		// Updates the cached value and updates the current
 		// total cost.
-		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost );
+		bool setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration );
+
+		// Returns the retention for an item, according to the
+		// current EvictionMode.
+		uint8_t retention( Cost cost, std::chrono::nanoseconds computeDuration ) const;
 
 		// Removes any cached value and updates the current total
 		// cost.
@@ -225,6 +340,10 @@ class LRUCache : private boost::noncopyable
 		// at or below the specified limit.
 		void limitCost( Cost cost );
 
+		// Returns the time elapsed since `start`, or zero if `start`
+		// is unset because the getter is not being timed.
+		static std::chrono::nanoseconds elapsed( std::chrono::steady_clock::time_point start );
+
 };
 
 } // namespace IECorePreview
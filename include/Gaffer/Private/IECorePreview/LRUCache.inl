@@ -49,6 +49,7 @@
 #include "tbb/spin_mutex.h"
 #include "tbb/spin_rw_mutex.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <tuple>
@@ -80,6 +81,12 @@ enum AcquireMode
 	InsertWritable
 };
 
+// The maximum number of items granted additional chances by the
+// CostAware eviction mode that `pop()` will skip over. Beyond this,
+// the next item is popped regardless of its remaining credit, so that
+// a single pop can't sweep the whole cache repeatedly.
+constexpr size_t maxRetainedPopVisits = 1024;
+
 
 // Uses a boost::multi_index_container to implement a map
 // and list in a single container. This gives much improved
@@ -95,11 +102,12 @@ class Serial
 
 		using CacheEntry = typename LRUCache::CacheEntry;
 		using Key = typename LRUCache::KeyType;
+		using Counters = typename LRUCache::template Counters<typename LRUCache::SingleWriterCounter>;
 
 		struct Item
 		{
 			Item( const Key &key )
-				:	key( key ), handleCount( 0 )
+				:	key( key ), handleCount( 0 ), credit( 0 )
 			{
 			}
 
@@ -111,6 +119,9 @@ class Serial
 			// get non-const access to it.
 			mutable CacheEntry cacheEntry;
 			mutable size_t handleCount;
+			// Number of times the item will be moved to the
+			// back of the list rather than being popped.
+			mutable uint8_t credit;
 		};
 
 		using MapAndList = boost::multi_index_container<
@@ -238,11 +249,13 @@ class Serial
 		}
 
 		// Marks the CacheEntry referred to by the handle as recently
-		// used.
+		// used. Entries with non-zero `CacheEntry::retention` should
+		// survive that many additional calls to `pop()`.
 		void push( Handle &handle )
 		{
 			List &list = m_mapAndList.template get<1>();
 			list.relocate( list.end(), list.iterator_to( *(handle.m_it) ) );
+			handle.m_it->credit = handle.m_it->cacheEntry.retention;
 		}
 
 		// Pops a copy of the least recently used CacheEntry from the policy,
@@ -257,11 +270,31 @@ class Serial
 			// access, there may still be existing handles if the
 			// GetterFunction has reentered the cache with a call
 			// to `get( someOtherKey )`, and this inner call has
-			// then entered `limitCost()`.
+			// then entered `limitCost()`. Items with credit remaining
+			// are moved to the back of the list, to be reconsidered
+			// once all others have been.
 			typename List::iterator it = list.begin();
-			while( it != list.end() && it->handleCount )
+			size_t numRetainedVisits = 0;
+			while( it != list.end() )
 			{
-				++it;
+				if( it->handleCount )
+				{
+					++it;
+				}
+				else if( it->credit && numRetainedVisits++ < maxRetainedPopVisits )
+				{
+					it->credit--;
+					typename List::iterator next = std::next( it );
+					if( next != list.end() )
+					{
+						list.relocate( list.end(), it );
+						it = next;
+					}
+				}
+				else
+				{
+					break;
+				}
 			}
 
 			if( it == list.end() )
@@ -279,11 +312,27 @@ class Serial
 			return true;
 		}
 
+		// Returns the Counters used to record statistics for
+		// the specified key.
+		Counters &counters( const Key &key )
+		{
+			return m_counters;
+		}
+
+		// Calls `f( counters )` for every set of Counters
+		// held by the policy.
+		template<typename F>
+		void visitCounters( F &&f )
+		{
+			f( m_counters );
+		}
+
 		typename LRUCache::Cost currentCost;
 
 	private :
 
 		MapAndList m_mapAndList;
+		Counters m_counters;
 
 };
 
@@ -298,20 +347,22 @@ class Parallel
 
 		using CacheEntry = typename LRUCache::CacheEntry;
 		using Key = typename LRUCache::KeyType;
+		using Counters = typename LRUCache::template Counters<typename LRUCache::AtomicCounter>;
 		using AtomicCost = std::atomic<typename LRUCache::Cost>;
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : credit( 0 ) {}
+			Item( const Key &key ) : key( key ), credit( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), credit( 0 ) {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = tbb::spin_rw_mutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of chances remaining before eviction, used
+			// in second-chance algorithm.
+			mutable std::atomic<uint8_t> credit;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -351,6 +402,7 @@ class Parallel
 			Map map;
 			using Mutex = tbb::spin_rw_mutex;
 			Mutex mutex;
+			Counters counters;
 		};
 
 		using Bins = std::vector<Bin>;
@@ -479,6 +531,7 @@ class Parallel
 							// the Item lock calls back into the cache and tries to
 							// access another item in the same Bin.
 							binLock.release();
+							bin.counters.contentionWaits.add( 1 );
 						}
 						// Check for cancellation before trying again. We could
 						// be waiting a while, and our caller may have lost interest
@@ -505,9 +558,10 @@ class Parallel
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
-			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// Items with non-zero retention are given additional
+			// chances. We don't need the handle to be writable
+			// to write here, because `credit` is atomic.
+			handle.m_item->credit.store( 1 + handle.m_item->cacheEntry.retention, std::memory_order_release );
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -529,6 +583,7 @@ class Parallel
 
 			typename Item::Mutex::scoped_lock itemLock;
 			int numFullIterations = 0;
+			size_t numRetainedVisits = 0;
 			while( true )
 			{
 				// If we're at the end of this bin, advance to
@@ -553,7 +608,7 @@ class Parallel
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
 							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// the `credit` for items or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -563,7 +618,14 @@ class Parallel
 
 				if( itemLock.try_acquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const uint8_t credit = m_popIterator->credit.load( std::memory_order_acquire );
+					if( credit > 1 )
+					{
+						// Credit beyond the usual second chance is
+						// granted only by the CostAware mode.
+						numRetainedVisits++;
+					}
+					if( !credit || numRetainedVisits > maxRetainedPopVisits )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -581,10 +643,10 @@ class Parallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently. Use up one of its
+						// chances, so we can pop it when it has none left,
+						// unless another thread resets the credit.
+						m_popIterator->credit.store( credit - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -599,6 +661,20 @@ class Parallel
 			}
 		}
 
+		Counters &counters( const Key &key )
+		{
+			return bin( key ).counters;
+		}
+
+		template<typename F>
+		void visitCounters( F &&f )
+		{
+			for( auto &bin : m_bins )
+			{
+				f( bin.counters );
+			}
+		}
+
 		AtomicCost currentCost;
 
 	private :
@@ -644,20 +720,22 @@ class TaskParallel
 
 		using CacheEntry = typename LRUCache::CacheEntry;
 		using Key = typename LRUCache::KeyType;
+		using Counters = typename LRUCache::template Counters<typename LRUCache::AtomicCounter>;
 		using AtomicCost = std::atomic<typename LRUCache::Cost>;
 
 		struct Item
 		{
-			Item() : recentlyUsed() {}
-			Item( const Key &key ) : key( key ), recentlyUsed() {}
-			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), recentlyUsed() {}
+			Item() : credit( 0 ) {}
+			Item( const Key &key ) : key( key ), credit( 0 ) {}
+			Item( const Item &other ) : key( other.key ), cacheEntry( other.cacheEntry ), credit( 0 ) {}
 			Key key;
 			mutable CacheEntry cacheEntry;
 			// Mutex to protect cacheEntry.
 			using Mutex = TaskMutex;
 			mutable Mutex mutex;
-			// Flag used in second-chance algorithm.
-			mutable std::atomic_bool recentlyUsed;
+			// Number of chances remaining before eviction, used
+			// in second-chance algorithm.
+			mutable std::atomic<uint8_t> credit;
 		};
 
 		// We would love to use one of TBB's concurrent containers as
@@ -697,6 +775,7 @@ class TaskParallel
 			Map map;
 			using Mutex = tbb::spin_rw_mutex;
 			Mutex mutex;
+			Counters counters;
 		};
 
 		using Bins = std::vector<Bin>;
@@ -855,6 +934,11 @@ class TaskParallel
 							return true;
 						}
 
+						// The Item lock was held by another thread. We may
+						// have helped it with its work in the meantime, but
+						// either way we must now retry.
+						bin.counters.contentionWaits.add( 1 );
+
 						IECore::Canceller::check( canceller );
 					}
 				}
@@ -890,9 +974,10 @@ class TaskParallel
 			// Simply mark the item as having been used
 			// recently. We will then give it a second chance
 			// in pop(), so it will not be evicted immediately.
-			// We don't need the handle to be writable to write
-			// here, because `recentlyUsed` is atomic.
-			handle.m_item->recentlyUsed.store( true, std::memory_order_release );
+			// Items with non-zero retention are given additional
+			// chances. We don't need the handle to be writable
+			// to write here, because `credit` is atomic.
+			handle.m_item->credit.store( 1 + handle.m_item->cacheEntry.retention, std::memory_order_release );
 		}
 
 		bool pop( Key &key, CacheEntry &cacheEntry )
@@ -914,6 +999,7 @@ class TaskParallel
 
 			typename Item::Mutex::ScopedLock itemLock;
 			int numFullIterations = 0;
+			size_t numRetainedVisits = 0;
 			while( true )
 			{
 				// If we're at the end of this bin, advance to
@@ -938,7 +1024,7 @@ class TaskParallel
 							// We're not empty, but we've been around and around
 							// without finding anything to pop. This could happen
 							// if other threads are frantically setting
-							// the `recentlyUsed` flag or if `clear()` is
+							// the `credit` for items or if `clear()` is
 							// called from `get()`, while `get()` holds the lock
 							// on the only item we could pop.
 							return false;
@@ -948,7 +1034,14 @@ class TaskParallel
 
 				if( itemLock.tryAcquire( m_popIterator->mutex ) )
 				{
-					if( !m_popIterator->recentlyUsed.load( std::memory_order_acquire ) )
+					const uint8_t credit = m_popIterator->credit.load( std::memory_order_acquire );
+					if( credit > 1 )
+					{
+						// Credit beyond the usual second chance is
+						// granted only by the CostAware mode.
+						numRetainedVisits++;
+					}
+					if( !credit || numRetainedVisits > maxRetainedPopVisits )
 					{
 						// Pop this item.
 						key = m_popIterator->key;
@@ -966,10 +1059,10 @@ class TaskParallel
 					}
 					else
 					{
-						// Item has been used recently. Flag it so we
-						// can pop it next time round, unless another
-						// thread resets the flag.
-						m_popIterator->recentlyUsed.store( false, std::memory_order_release );
+						// Item has been used recently. Use up one of its
+						// chances, so we can pop it when it has none left,
+						// unless another thread resets the credit.
+						m_popIterator->credit.store( credit - 1, std::memory_order_release );
 						itemLock.release();
 					}
 				}
@@ -984,6 +1077,20 @@ class TaskParallel
 			}
 		}
 
+		Counters &counters( const Key &key )
+		{
+			return bin( key ).counters;
+		}
+
+		template<typename F>
+		void visitCounters( F &&f )
+		{
+			for( auto &bin : m_bins )
+			{
+				f( bin.counters );
+			}
+		}
+
 		AtomicCost currentCost;
 
 	private :
@@ -1012,7 +1119,7 @@ class TaskParallel
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::CacheEntry::CacheEntry()
-	:	cost( 0 )
+	:	cost( 0 ), retention( 0 )
 {
 }
 
@@ -1022,12 +1129,89 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Status LRUCache<Key, Value, Po
 	return static_cast<Status>( state.which() );
 }
 
+// Counters
+// =======================================================================
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+LRUCache<Key, Value, Policy, GetterKey>::AtomicCounter::AtomicCounter()
+	:	m_value( 0 )
+{
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::AtomicCounter::add( uint64_t value )
+{
+	m_value.fetch_add( value, std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+uint64_t LRUCache<Key, Value, Policy, GetterKey>::AtomicCounter::get() const
+{
+	return m_value.load( std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::AtomicCounter::reset()
+{
+	m_value.store( 0, std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+LRUCache<Key, Value, Policy, GetterKey>::SingleWriterCounter::SingleWriterCounter()
+	:	m_value( 0 ), m_baseline( 0 )
+{
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::SingleWriterCounter::add( uint64_t value )
+{
+	// Only one thread ever writes `m_value`, so a plain load and store
+	// is sufficient, and is much cheaper than `fetch_add()`.
+	m_value.store( m_value.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+uint64_t LRUCache<Key, Value, Policy, GetterKey>::SingleWriterCounter::get() const
+{
+	return m_value.load( std::memory_order_relaxed ) - m_baseline.load( std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::SingleWriterCounter::reset()
+{
+	m_baseline.store( m_value.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+template<typename Counter>
+void LRUCache<Key, Value, Policy, GetterKey>::Counters<Counter>::accumulate( Statistics &statistics ) const
+{
+	statistics.hits += hits.get();
+	statistics.misses += misses.get();
+	statistics.evictions += evictions.get();
+	statistics.evictedCost += evictedCost.get();
+	statistics.computeDuration += std::chrono::nanoseconds( computeDuration.get() );
+	statistics.contentionWaits += contentionWaits.get();
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+template<typename Counter>
+void LRUCache<Key, Value, Policy, GetterKey>::Counters<Counter>::reset()
+{
+	hits.reset();
+	misses.reset();
+	evictions.reset();
+	evictedCost.reset();
+	computeDuration.reset();
+	contentionWaits.reset();
+}
+
 // LRUCache
 // =======================================================================
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 LRUCache<Key, Value, Policy, GetterKey>::LRUCache( GetterFunction getter, Cost maxCost, RemovalCallback removalCallback, bool cacheErrors )
-	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors )
+	:	m_getter( getter ), m_removalCallback( removalCallback ), m_maxCost( maxCost ), m_cacheErrors( cacheErrors ), m_evictionMode( EvictionMode::LRU )
 {
 }
 
@@ -1074,6 +1258,38 @@ typename LRUCache<Key, Value, Policy, GetterKey>::Cost LRUCache<Key, Value, Poli
 	return m_policy.currentCost;
 }
 
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::setEvictionMode( EvictionMode evictionMode )
+{
+	m_evictionMode = evictionMode;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::EvictionMode LRUCache<Key, Value, Policy, GetterKey>::getEvictionMode() const
+{
+	return m_evictionMode;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+typename LRUCache<Key, Value, Policy, GetterKey>::Statistics LRUCache<Key, Value, Policy, GetterKey>::statistics() const
+{
+	Statistics result;
+	// Preferring const_cast over forcing all policies to implement
+	// a const `visitCounters()` variant.
+	const_cast<Policy<LRUCache> &>( m_policy ).visitCounters(
+		[&result] ( const auto &counters ) { counters.accumulate( result ); }
+	);
+	return result;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+void LRUCache<Key, Value, Policy, GetterKey>::resetStatistics()
+{
+	m_policy.visitCounters(
+		[] ( auto &counters ) { counters.reset(); }
+	);
+}
+
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const IECore::Canceller *canceller )
 {
@@ -1082,32 +1298,45 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 	const CacheEntry &cacheEntry = handle.readable();
 	const Status status = cacheEntry.status();
 
+	auto &counters = m_policy.counters( key );
+
 	if( status==Uncached )
 	{
 		assert( handle.isWritable() );
+		counters.misses.add( 1 );
 		Value value = Value();
 		Cost cost = 0;
+		// Only the CostAware mode needs to know how long the getter took,
+		// so we avoid reading the clock otherwise.
+		std::chrono::steady_clock::time_point getterStart;
+		if( m_evictionMode.load( std::memory_order_relaxed ) == EvictionMode::CostAware )
+		{
+			getterStart = std::chrono::steady_clock::now();
+		}
 		try
 		{
 			handle.execute( [this, &value, &key, &cost, canceller] { value = m_getter( key, cost, canceller ); } );
 		}
 		catch( IECore::Cancelled const & )
 		{
+			counters.computeDuration.add( elapsed( getterStart ).count() );
 			throw;
 		}
 		catch( ... )
 		{
+			counters.computeDuration.add( elapsed( getterStart ).count() );
 			if( m_cacheErrors )
 			{
 				handle.writable().state = std::current_exception();
 			}
 			throw;
 		}
+		const std::chrono::nanoseconds getterDuration = elapsed( getterStart );
 
 		assert( cacheEntry.status() != Cached ); // this would indicate that another thread somehow
 		assert( cacheEntry.status() != Failed ); // loaded the same thing as us, which is not the intention.
 
-		setInternal( key, handle.writable(), value, cost );
+		setInternal( key, handle.writable(), value, cost, getterDuration );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1118,10 +1347,12 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 	else if( status==Cached )
 	{
 		m_policy.push( handle );
+		counters.hits.add( 1 );
 		return boost::get<Value>( cacheEntry.state );
 	}
 	else
 	{
+		counters.hits.add( 1 );
 		std::rethrow_exception( boost::get<std::exception_ptr>( cacheEntry.state ) );
 	}
 }
@@ -1129,9 +1360,12 @@ Value LRUCache<Key, Value, Policy, GetterKey>::get( const GetterKey &key, const
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const Key &key )
 {
+	auto &counters = m_policy.counters( key );
+
 	typename Policy<LRUCache>::Handle handle;
 	if( !m_policy.acquire( key, handle, LRUCachePolicy::FindReadable, /* canceller = */ nullptr ) )
 	{
+		counters.misses.add( 1 );
 		return std::nullopt;
 	}
 
@@ -1140,26 +1374,29 @@ std::optional<Value> LRUCache<Key, Value, Policy, GetterKey>::getIfCached( const
 
 	if( status==Uncached )
 	{
+		counters.misses.add( 1 );
 		return std::nullopt;
 	}
 	else if( status==Cached )
 	{
 		m_policy.push( handle );
+		counters.hits.add( 1 );
 		return boost::get<Value>( cacheEntry.state );
 	}
 	else
 	{
+		counters.hits.add( 1 );
 		std::rethrow_exception( boost::get<std::exception_ptr>( cacheEntry.state ) );
 	}
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::InsertWritable, /* canceller = */ nullptr );
 	assert( handle.isWritable() );
-	bool result = setInternal( key, handle.writable(), value, cost );
+	bool result = setInternal( key, handle.writable(), value, cost, computeDuration );
 	m_policy.push( handle );
 	handle.release();
 	limitCost( m_maxCost );
@@ -1168,7 +1405,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::set( const Key &key, const Value &
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
 template<typename CostFunction>
-bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction )
+bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, const Value &value, CostFunction &&costFunction, std::chrono::nanoseconds computeDuration )
 {
 	typename Policy<LRUCache>::Handle handle;
 	m_policy.acquire( key, handle, LRUCachePolicy::Insert, /* canceller = */ nullptr );
@@ -1179,7 +1416,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 	if( status == Uncached )
 	{
 		assert( handle.isWritable() );
-		result = setInternal( key, handle.writable(), value, costFunction( value ) );
+		result = setInternal( key, handle.writable(), value, costFunction( value ), computeDuration );
 		m_policy.push( handle );
 
 		handle.release();
@@ -1189,7 +1426,7 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setIfUncached( const Key &key, con
 }
 
 template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
-bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost )
+bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, CacheEntry &cacheEntry, const Value &value, Cost cost, std::chrono::nanoseconds computeDuration )
 {
 	eraseInternal( key, cacheEntry );
 
@@ -1200,6 +1437,12 @@ bool LRUCache<Key, Value, Policy, GetterKey>::setInternal( const Key &key, Cache
 
 	cacheEntry.state = value;
 	cacheEntry.cost = cost;
+	cacheEntry.retention = retention( cost, computeDuration );
+
+	if( computeDuration.count() )
+	{
+		m_policy.counters( key ).computeDuration.add( computeDuration.count() );
+	}
 
 	m_policy.currentCost += cost;
 
@@ -1275,8 +1518,49 @@ void LRUCache<Key, Value, Policy, GetterKey>::limitCost( Cost cost )
 			break;
 		}
 
-		eraseInternal( key, cacheEntry );
+		const Cost evictedCost = cacheEntry.cost;
+		if( eraseInternal( key, cacheEntry ) )
+		{
+			auto &counters = m_policy.counters( key );
+			counters.evictions.add( 1 );
+			counters.evictedCost.add( evictedCost );
+		}
+	}
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+uint8_t LRUCache<Key, Value, Policy, GetterKey>::retention( Cost cost, std::chrono::nanoseconds computeDuration ) const
+{
+	if( m_evictionMode.load( std::memory_order_relaxed ) == EvictionMode::LRU )
+	{
+		return 0;
+	}
+
+	// GreedyDual-Size gives each item a priority proportional to the
+	// time taken to compute it, divided by its cost. We don't have a
+	// priority queue, so we approximate by granting one additional
+	// chance in `Policy::pop()` for each doubling of the compute time
+	// per unit cost. This also ages priorities in the same way as
+	// GreedyDual-Size, since all items lose a chance on each pass.
+	const uint8_t maxRetention = 7;
+	uint64_t timePerCost = computeDuration.count() / std::max<Cost>( cost, 1 );
+	uint8_t result = 0;
+	while( timePerCost && result < maxRetention )
+	{
+		timePerCost >>= 1;
+		result++;
+	}
+	return result;
+}
+
+template<typename Key, typename Value, template <typename> class Policy, typename GetterKey>
+std::chrono::nanoseconds LRUCache<Key, Value, Policy, GetterKey>::elapsed( std::chrono::steady_clock::time_point start )
+{
+	if( start == std::chrono::steady_clock::time_point() )
+	{
+		return std::chrono::nanoseconds( 0 );
 	}
+	return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - start );
 }
 
 } // namespace IECorePreview
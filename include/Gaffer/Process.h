@@ -99,6 +99,11 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// the original caller.
 		[[noreturn]] void handleException() const;
 
+		/// Returns true if any monitors will be notified about this
+		/// process. Derived classes may use this to avoid preparing
+		/// information that is only of interest to monitors.
+		inline bool monitored() const;
+
 		/// Searches for an in-flight process and waits for its result, collaborating
 		/// on any TBB tasks it spawns. If no such process exists, constructs one
 		/// using `args` and makes it available for collaboration by other threads,
@@ -114,12 +119,21 @@ class GAFFER_API Process : private ThreadState::Scope
 		/// - `ProcessType::g_cache` is a static LRUCache of type `ProcessType::CacheType`
 		///   to be used for the caching of the result.
 		/// - `ProcessType::cacheCostFunction()` is a static function suitable
-		///   for use with `CacheType::setIfUncached()`.
+		///   for use with `CacheType::setIfUncached()`. The time taken by `run()`
+		///   is also passed to `setIfUncached()`, for use by the cache's
+		///   EvictionMode.
 		///
 		template<typename ProcessType, typename... ProcessArguments>
 		static typename ProcessType::ResultType acquireCollaborativeResult(
 			const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
 		);
+		/// As above, but publishing the result to `cache` rather than to
+		/// `ProcessType::g_cache`. This allows processes to divide their
+		/// results between several caches.
+		template<typename ProcessType, typename... ProcessArguments>
+		static typename ProcessType::ResultType acquireCollaborativeResult(
+			typename ProcessType::CacheType &cache, const typename ProcessType::CacheType::KeyType &cacheKey, ProcessArguments&&... args
+		);
 
 	private :
 
@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Gaffer/Monitor.h"
+#include "Gaffer/ThreadMonitor.h"
+
+#include "IECore/MurmurHash.h"
+
+#include "boost/chrono.hpp"
+
+#include "tbb/enumerable_thread_specific.h"
+
+#include <iosfwd>
+#include <vector>
+
+namespace Gaffer
+{
+
+IE_CORE_FORWARDDECLARE( Plug )
+
+/// A monitor which records the start and finish of every process, preserving
+/// the timeline that is discarded by the PerformanceMonitor. The timeline can
+/// be written in Chrome's trace event format, for viewing in Perfetto
+/// (https://ui.perfetto.dev) or `chrome://tracing`.
+class GAFFER_API TraceMonitor : public Monitor
+{
+
+	public :
+
+		/// Only processes with a type in `processMask` are recorded. An
+		/// empty mask records processes of all types.
+		TraceMonitor( const std::vector<IECore::InternedString> &processMask = {} );
+		~TraceMonitor() override;
+
+		IE_CORE_DECLAREMEMBERPTR( TraceMonitor )
+
+		struct Event
+		{
+			ConstPlugPtr plug;
+			IECore::InternedString type;
+			IECore::MurmurHash contextHash;
+			/// Identifiers for the process and the process that invoked it
+			/// (which may be on another thread). Identifiers are unique
+			/// among processes that are running at the same time, but may
+			/// be reused after a process has finished. The `parentId` is 0
+			/// for processes without a parent.
+			uint64_t processId;
+			uint64_t parentId;
+			ThreadMonitor::ThreadId threadId;
+			/// Measured relative to the construction of the monitor.
+			boost::chrono::nanoseconds start;
+			boost::chrono::nanoseconds finish;
+		};
+
+		using Events = std::vector<Event>;
+
+		/// Query functions. These are not thread-safe, and must be called
+		/// only when the Monitor is not active (as defined by `Monitor::Scope`).
+		/// Returns all completed events, sorted by start time.
+		const Events &events() const;
+		/// Writes all completed events as JSON in Chrome's trace event format.
+		/// Processes invoked on behalf of a process on another thread are
+		/// linked to it by flow events.
+		void writeChromeTrace( std::ostream &stream ) const;
+		/// As above, but writing to a file. Throws if the file can't be written.
+		void writeChromeTrace( const std::string &fileName ) const;
+
+	protected :
+
+		void processStarted( const Process *process ) override;
+		void processFinished( const Process *process ) override;
+
+	private :
+
+		bool masked( const Process *process ) const;
+
+		const std::vector<IECore::InternedString> m_processMask;
+		const boost::chrono::high_resolution_clock::time_point m_startTime;
+
+		// We record events into a per-thread data structure to avoid contention.
+		struct ThreadData
+		{
+			ThreadData();
+			ThreadMonitor::ThreadId id;
+			Events events;
+			// Indices into `events` for the processes currently
+			// running on this thread.
+			std::vector<size_t> stack;
+		};
+		mutable tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance> m_threadData;
+
+		// Then when we want to query it, we collate it into `m_events`.
+		void collate() const;
+		mutable Events m_events;
+
+};
+
+IE_CORE_DECLAREPTR( TraceMonitor )
+
+} // namespace Gaffer
@@ -41,11 +41,15 @@
 
 #include "IECore/Object.h"
 
+#include <chrono>
+
 namespace Gaffer
 {
 
 IE_CORE_FORWARDDECLARE( DependencyNode )
 
+class Process;
+
 /// The Plug base class defines the concept of a connection
 /// point with direction. The ValuePlug class extends this concept
 /// to allow the connections to pass values between connection
@@ -150,14 +154,133 @@ class GAFFER_API ValuePlug : public Plug
 		/// of the cache.
 		////////////////////////////////////////////////////////////////////
 		//@{
-		/// Returns the maximum amount of memory in bytes to use for the cache.
+		/// Returns the maximum amount of memory in bytes to use for the
+		/// default cache partition.
 		static size_t getCacheMemoryLimit();
-		/// Sets the maximum amount of memory the cache may use in bytes.
+		/// Sets the maximum amount of memory the default cache partition
+		/// may use in bytes.
 		static void setCacheMemoryLimit( size_t bytes );
-		/// Returns the current memory usage of the cache in bytes.
+		/// Returns the current memory usage of all cache partitions in bytes.
 		static size_t cacheMemoryUsage();
-		/// Clears the cache.
+		/// Clears all cache partitions.
 		static void clearCache();
+		using CacheClearedSignal = Signals::Signal<void (), Signals::CatchingCombiner<void>>;
+		/// Emitted by `clearCache()`. This allows other caches of computed
+		/// results to be cleared at the same time.
+		static CacheClearedSignal &cacheClearedSignal();
+		/// Removes the value of this plug in the current context from the
+		/// cache, if present. This allows clients that know a value won't be
+		/// needed again, such as batch renders, to release its memory without
+		/// waiting for it to be evicted. The value is not written to the disk
+		/// cache, and will be recomputed if it is requested again.
+		void removeCachedValue() const;
+
+		enum class CacheEvictionMode
+		{
+			/// Evicts the least recently used values first.
+			LRU,
+			/// Preferentially retains values that took a long time to
+			/// compute relative to their memory usage.
+			CostAware
+		};
+
+		/// Sets the policy used to choose values to evict from all cache
+		/// partitions when they exceed their memory limit.
+		static void setCacheEvictionMode( CacheEvictionMode mode );
+		static CacheEvictionMode getCacheEvictionMode();
+
+		/// Statistics describing the effectiveness of a cache. Hits and
+		/// misses count individual cache lookups, and a single compute
+		/// may perform more than one lookup.
+		struct CacheStatistics
+		{
+			/// Number of lookups that found a cached value.
+			uint64_t hits = 0;
+			/// Number of lookups that did not find a cached value.
+			uint64_t misses = 0;
+			/// Number of values evicted to meet the limit.
+			uint64_t evictions = 0;
+			/// Total cost of the evicted values. This is measured in bytes
+			/// for the compute cache and in entries for the hash cache.
+			uint64_t evictedCost = 0;
+			/// Number of times a thread had to wait for a value that was
+			/// being computed or updated by another thread.
+			uint64_t contentionWaits = 0;
+			/// Total time spent computing the values stored in the cache.
+			/// This is only measured while the CostAware eviction mode is
+			/// active, and is zero otherwise.
+			std::chrono::nanoseconds computeDuration = std::chrono::nanoseconds( 0 );
+		};
+
+		/// Returns statistics accumulated over all cache partitions.
+		static CacheStatistics cacheStatistics();
+		/// Resets the statistics for all cache partitions.
+		static void resetCacheStatistics();
+		//@}
+
+		/// @name Cache partitions
+		/// The cache may be divided into named partitions, each with its own
+		/// memory limit, so that values needed by one workload are not evicted
+		/// by another. Nodes choose a partition for each output plug via
+		/// `ComputeNode::computeCachePartition()`, but values are only stored
+		/// separately if a limit has been set for that partition using
+		/// `setCachePartitionMemoryLimit()`. Values for all other partitions
+		/// are stored in the default partition, which is named "". Values
+		/// computed before a partition was created remain in the default
+		/// partition, and are moved to the new partition the next time they
+		/// are requested.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Returns the names of all partitions, including the default.
+		static std::vector<IECore::InternedString> cachePartitions();
+		/// Returns the memory limit for the specified partition.
+		static size_t getCachePartitionMemoryLimit( const IECore::InternedString &partition );
+		/// Sets the memory limit for the specified partition, creating
+		/// the partition if it doesn't exist already.
+		static void setCachePartitionMemoryLimit( const IECore::InternedString &partition, size_t bytes );
+		/// Returns the current memory usage of the specified partition.
+		static size_t cachePartitionMemoryUsage( const IECore::InternedString &partition );
+
+		/// Returns statistics for the specified partition.
+		static CacheStatistics cachePartitionStatistics( const IECore::InternedString &partition );
+		//@}
+
+		/// @name Disk cache management
+		/// Values evicted from the in-memory cache may optionally be written
+		/// to a directory on disk, from where they can be reloaded instead of
+		/// being recomputed. The directory may be shared by any number of
+		/// processes on the same host. The disk cache is disabled by default,
+		/// and may be enabled via the `GAFFER_DISK_CACHE_DIRECTORY` environment
+		/// variable.
+		///
+		/// Values are written by a background thread, so that eviction doesn't
+		/// delay the compute that triggered it.
+		///
+		/// > Caution : Values are keyed purely by hash, so this is only safe
+		/// > for processes using the same version of Gaffer and its extensions.
+		/// > Likewise, the hashes for nodes that read files don't account for
+		/// > the modification time of the file, so if a file is rewritten in
+		/// > place, stale results may be loaded from the disk cache. Call
+		/// > `clearDiskCache()` after modifying files in place.
+		////////////////////////////////////////////////////////////////////
+		//@{
+		/// Sets the directory used to store the disk cache. An empty string
+		/// disables the disk cache.
+		static void setDiskCacheDirectory( const std::string &directory );
+		static std::string getDiskCacheDirectory();
+		/// Returns the maximum size of the disk cache in bytes.
+		static size_t getDiskCacheSizeLimit();
+		/// Sets the maximum size of the disk cache in bytes. The least
+		/// recently used files are removed when the limit is exceeded.
+		static void setDiskCacheSizeLimit( size_t bytes );
+		/// Returns the total size of the files in the disk cache. This
+		/// includes files written by other processes. Waits for any
+		/// pending writes to complete first.
+		static size_t diskCacheUsage();
+		/// Removes all files from the disk cache. Note that `clearCache()`
+		/// discards values without writing them to the disk cache, but does
+		/// not remove existing files.
+		static void clearDiskCache();
 		//@}
 
 		/// @name Hash cache management
@@ -178,6 +301,11 @@ class GAFFER_API ValuePlug : public Plug
 		/// > to force all thread-local caches to be cleared immediately
 		/// > (this is not thread-safe with respect to concurrent computations).
 		static void clearHashCache( bool now = false );
+		/// Returns statistics accumulated over the global and per-thread
+		/// hash caches.
+		static CacheStatistics hashCacheStatistics();
+		/// Resets the statistics for the hash cache.
+		static void resetHashCacheStatistics();
 
 		/// The standard hash cache mode relies on correctly implemented
 		/// affects() methods to selectively clear the cache for dirtied
@@ -267,6 +395,17 @@ class GAFFER_API ValuePlug : public Plug
 		class ComputeProcess;
 		class SetValueAction;
 
+		// Used by MemoryMonitor to attribute cache usage to individual plugs.
+		// `computeResult()` returns the result of a ComputeProcess from within
+		// `Monitor::processFinished()`, along with the key used to cache it (null
+		// if the result is not cached). `hashCacheContains()` only considers
+		// the global hash cache and the calling thread's own cache, so should
+		// be called from the thread that performed the hash.
+		friend class MemoryMonitor;
+		static const IECore::Object *computeResult( const Process *computeProcess, const IECore::MurmurHash *&cacheKey );
+		static bool computeCacheContains( const IECore::MurmurHash &cacheKey );
+		static bool hashCacheContains( const ValuePlug *plug, const IECore::MurmurHash &contextHash, uint64_t dirtyCount );
+
 		const IECore::Object *getValueInternal( IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash = nullptr ) const;
 		void setValueInternal( IECore::ConstObjectPtr value, bool propagateDirtiness );
 		void childAddedOrRemoved();
@@ -49,6 +49,17 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 {
 	public :
 
+		enum class Mode
+		{
+			// Filters with a gaussian via the internal Resample node. Cost
+			// per pixel is proportional to the radius.
+			Accurate,
+			// Approximates a gaussian using three passes of a box filter,
+			// computed with running sums. Cost per pixel is almost
+			// independent of the radius.
+			Fast
+		};
+
 		explicit Blur( const std::string &name=defaultName<Blur>() );
 		~Blur() override;
 
@@ -63,6 +74,9 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Gaffer::BoolPlug *expandDataWindowPlug();
 		const Gaffer::BoolPlug *expandDataWindowPlug() const;
 
+		Gaffer::IntPlug *modePlug();
+		const Gaffer::IntPlug *modePlug() const;
+
 		void affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const override;
 
 	protected :
@@ -83,6 +97,12 @@ class GAFFERIMAGE_API Blur : public FlatImageProcessor
 		Resample *resample();
 		const Resample *resample() const;
 
+		// Output plug holding the result of the horizontal pass
+		// in Fast mode, so that it is cached for use by the vertical
+		// pass. Evaluated in the same context as the channel data.
+		Gaffer::FloatVectorDataPlug *horizontalPassPlug();
+		const Gaffer::FloatVectorDataPlug *horizontalPassPlug() const;
+
 		void hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		void compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const override;
 
@@ -79,7 +79,14 @@ class GAFFERIMAGE_API ChannelDataProcessor : public ImageProcessor
 		/// @param channelIndex An index in the range of 0-3 which indicates whether the channel to be processed is R, G, B or A.
 		///                     It is useful for querying Color4f plugs for the value that coresponds to the channel being processed.
 		/// @param outData The tile where the result of the operation should be written. It is initialized with the coresponding tile data from inPlug() which should be used as the input data.
+		///                If `acceptsUniformData()` returns true and the input tile is uniform, outData instead contains just a
+		///                single value, and the result is expanded to a uniform tile afterwards.
 		virtual void processChannelData( const Gaffer::Context *context, const ImagePlug *parent, const std::string &channel, IECore::FloatVectorDataPtr outData ) const = 0;
+		/// May be implemented by derived classes to return true if `processChannelData()` can
+		/// be passed a single value representing a uniform tile. Implementations which combine
+		/// outData with other per-pixel data must then resize it to match that data first.
+		/// The default implementation returns false.
+		virtual bool acceptsUniformData() const;
 
 		void hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 
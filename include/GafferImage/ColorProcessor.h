@@ -70,6 +70,8 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
 
 		/// Function object used to implement the processing of color values.
+		/// The vectors contain one value per pixel, or a single value per channel
+		/// for uniform tiles if `acceptsUniformData()` returns true.
 		using ColorProcessorFunction = std::function<void ( IECore::FloatVectorData *r, IECore::FloatVectorData *g, IECore::FloatVectorData *b )>;
 
 		/// Must be implemented by derived classes to return true if the specified input is used in `colorProcessor()`.
@@ -79,6 +81,10 @@ class GAFFERIMAGE_API ColorProcessor : public ImageProcessor
 		/// Must be implemented by derived classes to return a ColorProcessorFunction. An empty function
 		/// may be returned, in which case the node will pass through the input image data unchanged.
 		virtual ColorProcessorFunction colorProcessor( const Gaffer::Context *context ) const = 0;
+		/// May be implemented by derived classes to return true if the ColorProcessorFunction
+		/// processes each element independently, and can therefore be passed a single value
+		/// per channel representing a uniform tile. The default implementation returns false.
+		virtual bool acceptsUniformData() const;
 
 	private :
 
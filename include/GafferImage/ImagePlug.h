@@ -255,6 +255,19 @@ class GAFFERIMAGE_API ImagePlug : public Gaffer::ValuePlug
 		static const IECore::FloatVectorData *emptyTile();
 		static const IECore::FloatVectorData *blackTile();
 		static const IECore::FloatVectorData *whiteTile();
+		/// Returns a flat tile with every pixel set to `value`. Tiles are
+		/// shared between all callers requesting the same value, so
+		/// constant regions of an image occupy almost no memory. The
+		/// `blackTile()` and `whiteTile()` singletons are returned for 0 and 1.
+		static IECore::ConstFloatVectorDataPtr uniformTile( float value );
+		/// Returns true if every element of `tile` has the same value,
+		/// storing that value in `value`. The black and white tiles are
+		/// recognised without inspecting their pixels, and other tiles are
+		/// rejected as soon as a differing pixel is found. Uniform tiles
+		/// still require a full scan, so this should only be used where the
+		/// fast path saves more than that. Empty tiles are never considered
+		/// uniform.
+		static bool isUniformTile( const IECore::FloatVectorData *tile, float &value );
 
 		static constexpr int tileSize() { return 1 << tileSizeLog2(); };
 		static constexpr int tilePixels() { return tileSize() * tileSize(); };
@@ -96,6 +96,7 @@ class GAFFERIMAGE_API OpenColorIOTransform : public ColorProcessor
 		bool affectsColorProcessor( const Gaffer::Plug *input ) const final;
 		void hashColorProcessor( const Gaffer::Context *context, IECore::MurmurHash &h ) const final;
 		ColorProcessorFunction colorProcessor( const Gaffer::Context *context ) const final;
+		bool acceptsUniformData() const final;
 
 		OCIO_NAMESPACE::ConstContextRcPtr modifiedOCIOContext( OCIO_NAMESPACE::ConstContextRcPtr context ) const;
 
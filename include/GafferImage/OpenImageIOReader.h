@@ -92,6 +92,14 @@ class GAFFERIMAGE_API OpenImageIOReader : public ImageNode
 		static void setOpenFilesLimit( size_t maxOpenFiles );
 		static size_t getOpenFilesLimit();
 
+		/// When on, channels stored as half in the file are also stored as half
+		/// in the internal tile batches held in the compute cache, halving their
+		/// memory usage. Channel data is converted back to float whenever it is
+		/// accessed via `ImagePlug::channelData()`, so the values output by the
+		/// node are identical in either mode. Off by default.
+		static void setHalfPrecisionTileStorage( bool halfPrecisionTileStorage );
+		static bool getHalfPrecisionTileStorage();
+
 		static size_t supportedExtensions( std::vector<std::string> &extensions );
 
 	protected :
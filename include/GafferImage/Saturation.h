@@ -60,6 +60,7 @@ class GAFFERIMAGE_API Saturation : public ColorProcessor
 		bool affectsColorProcessor( const Gaffer::Plug *input ) const override;
 		void hashColorProcessor( const Gaffer::Context *context, IECore::MurmurHash &h ) const override;
 		ColorProcessorFunction colorProcessor( const Gaffer::Context *context ) const override;
+		bool acceptsUniformData() const override;
 
 	private :
 
@@ -230,6 +230,14 @@ class GAFFERSCENE_API BranchCreator : public FilteredSceneProcessor
 		// the names of any `NewDestination/NewAncestor` children at this location.
 		LocationType sourceAndBranchPaths( const ScenePath &path, ScenePath &sourcePath, ScenePath &branchPath, IECore::ConstInternedStringVectorDataPtr *newChildNames = nullptr ) const;
 
+		// For a `Destination` or `Ancestor` location, fills `childNames` with the
+		// children which are not passed through unchanged from the input. The bounds
+		// of all other children are already accounted for by the input bound, so
+		// need not be visited when computing the output bound. Returns false if
+		// most children are modified, in which case `childBoundsPlug()` should
+		// be used instead.
+		bool modifiedChildNames( const ScenePath &path, std::vector<IECore::InternedString> &childNames ) const;
+
 		static size_t g_firstPlugIndex;
 
 };
@@ -38,6 +38,7 @@
 
 #include "GafferScene/ObjectProcessor.h"
 
+#include "Gaffer/NumericPlug.h"
 #include "Gaffer/StringPlug.h"
 #include "Gaffer/TypedPlug.h"
 
@@ -73,6 +74,9 @@ class GAFFERSCENE_API MeshTessellate : public ObjectProcessor
 		Gaffer::StringPlug *triangleSubdivisionRulePlug();
 		const Gaffer::StringPlug *triangleSubdivisionRulePlug() const;
 
+		Gaffer::FloatPlug *maxEdgeLengthPlug();
+		const Gaffer::FloatPlug *maxEdgeLengthPlug() const;
+
 		GAFFER_NODE_DECLARE_TYPE( GafferScene::MeshTessellate, MeshTessellateTypeId, ObjectProcessor );
 
 	protected :
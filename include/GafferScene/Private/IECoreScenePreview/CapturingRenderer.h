@@ -156,6 +156,13 @@ class GAFFERSCENE_API CapturingRenderer : public Renderer
 		std::vector<std::string> capturedObjectNames() const;
 		const CapturedObject *capturedObject( const std::string &name ) const;
 
+		/// Returns the number of distinct objects currently captured, as
+		/// identified by `TranslationCache::samplesHash()`. Comparing this to
+		/// the number of captured objects measures the instancing that a
+		/// renderer backend could achieve. The objects are hashed on each
+		/// call, so this should not be called frequently.
+		size_t numUniqueObjects() const;
+
 		/// Renderer interface
 		/// ==================
 
@@ -45,12 +45,17 @@ namespace IECoreScenePreview
 namespace MeshAlgo
 {
 
+/// Tessellates `mesh` according to its subdivision scheme, inserting `divisions` vertices along each edge.
+/// If `maxEdgeLength` is greater than zero, the tessellation is adaptive instead : each edge receives only
+/// as many divisions as are needed to bring the output edges below `maxEdgeLength` ( measured on the
+/// control cage, in object space ), with `divisions` acting as the maximum.
 GAFFERSCENE_API IECoreScene::MeshPrimitivePtr tessellateMesh(
 	const IECoreScene::MeshPrimitive &mesh, int divisions,
 	bool calculateNormals = false, IECore::InternedString scheme = "",
 	IECore::InternedString interpolateBoundary = "",
 	IECore::InternedString faceVaryingLinearInterpolation = "",
 	IECore::InternedString triangleSubdivisionRule = "",
+	float maxEdgeLength = 0.0f,
 	const IECore::Canceller *canceller = nullptr
 );
 
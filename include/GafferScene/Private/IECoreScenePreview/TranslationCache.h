@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "GafferScene/Export.h"
+
+#include "IECore/MurmurHash.h"
+#include "IECore/Object.h"
+
+#include <functional>
+#include <vector>
+
+namespace IECoreScenePreview
+{
+
+/// A process-wide cache for the parts of object translation that don't
+/// depend on the renderer, such as triangulating meshes or resampling
+/// primitive variables. Results are keyed by the hash of the source object
+/// and the operation applied to it, so that identical geometry at different
+/// locations is processed only once, and the results are shared by all
+/// Renderer instances, whatever their backend.
+///
+/// Renderer-specific data such as native nodes and buffers are owned by
+/// a particular render and can't be shared in this way, so backends
+/// continue to manage their own instancing for those. They should use
+/// `samplesHash()` to identify geometry, so that all backends instance
+/// according to the same rules.
+namespace TranslationCache
+{
+
+using Translator = std::function<IECore::ConstObjectPtr ()>;
+
+/// Returns the result of `translator`, computing it only if a result for
+/// `key` is not already cached. The result must depend only on `key`, which
+/// will typically be the hash of the source object with the name and
+/// parameters of the operation appended. May be called concurrently.
+GAFFERSCENE_API IECore::ConstObjectPtr get( const IECore::MurmurHash &key, const Translator &translator );
+
+/// Returns a hash identifying the geometry of a set of deformation samples.
+GAFFERSCENE_API IECore::MurmurHash samplesHash( const std::vector<const IECore::Object *> &samples, const std::vector<float> &times );
+
+/// Sets the maximum memory used by the cache, in bytes.
+GAFFERSCENE_API void setMemoryLimit( size_t bytes );
+GAFFERSCENE_API size_t getMemoryLimit();
+/// Returns the memory currently used by the cache, in bytes.
+GAFFERSCENE_API size_t memoryUsage();
+GAFFERSCENE_API void clear();
+
+struct Statistics
+{
+	/// Number of calls to `get()` that found a cached result.
+	uint64_t hits = 0;
+	/// Number of calls to `get()` that called the translator.
+	uint64_t misses = 0;
+};
+
+GAFFERSCENE_API Statistics statistics();
+GAFFERSCENE_API void resetStatistics();
+
+} // namespace TranslationCache
+
+} // namespace IECoreScenePreview
@@ -230,7 +230,8 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		void addFilterLink( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const std::string &filteredLightsExpression );
 		void removeFilterLink( const IECoreScenePreview::Renderer::ObjectInterfacePtr &lightFilter, const std::string &filteredLightsExpression );
 		std::string filteredLightsExpression( const IECore::CompoundObject *attributes ) const;
-		IECoreScenePreview::Renderer::ConstObjectSetPtr linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene ) const;
+		/// If `changed` is passed, it is set to true if the result may have changed since the last call to `clean()`.
+		IECoreScenePreview::Renderer::ConstObjectSetPtr linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene, bool *changed = nullptr ) const;
 		void outputLightFilterLinks( const std::string &lightName, IECoreScenePreview::Renderer::ObjectInterface *light ) const;
 		void clearLightLinks();
 
@@ -246,9 +247,20 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 		/// ===========================
 		///
 		/// This maps from `linkedLights` expressions to ObjectSets containing
-		/// the relevant lights.
+		/// the relevant lights. When the sets are dirtied, we keep the previous
+		/// ObjectSets so that we can tell which expressions have actually changed,
+		/// and relink only the objects that use them.
 
-		using LightLinkMap = tbb::concurrent_hash_map<std::string, IECoreScenePreview::Renderer::ObjectSetPtr>;
+		struct LightLink
+		{
+			IECoreScenePreview::Renderer::ObjectSetPtr objectSet;
+			/// True if `objectSet` must be recomputed because the sets have been dirtied.
+			bool dirty = false;
+			/// True if `objectSet` may have changed since the last call to `clean()`.
+			bool changed = true;
+		};
+
+		using LightLinkMap = tbb::concurrent_hash_map<std::string, LightLink>;
 		mutable LightLinkMap m_lightLinks;
 		tbb::spin_mutex m_lightLinksClearMutex;
 
@@ -282,7 +294,14 @@ class GAFFERSCENE_API LightLinks : boost::noncopyable
 GAFFERSCENE_API void outputCameras( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, IECoreScenePreview::Renderer *renderer );
 GAFFERSCENE_API void outputLightFilters( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
 GAFFERSCENE_API void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer );
-GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath() );
+/// If `releaseObjects` is true, each object is removed from the compute cache as
+/// soon as it has been passed to the renderer, so that the memory used by the
+/// scene is bounded by the objects currently being output rather than by the
+/// size of the whole scene. Objects shared by sibling locations, such as those
+/// generated by Duplicate or Instancer, are released after the last of them has
+/// been visited. This is intended for batch renders, where the objects will not
+/// be needed again.
+GAFFERSCENE_API void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root = ScenePlug::ScenePath(), bool releaseObjects = false );
 
 } // namespace RendererAlgo
 
@@ -125,6 +125,9 @@ class GAFFERSCENE_API SceneNode : public Gaffer::ComputeNode
 
 		Gaffer::ValuePlug::CachePolicy hashCachePolicy( const Gaffer::ValuePlug *output ) const override;
 		Gaffer::ValuePlug::CachePolicy computeCachePolicy( const Gaffer::ValuePlug *output ) const override;
+		/// Returns "scene.object" and "scene.set" for the object and set plugs
+		/// respectively, so that their memory usage can be controlled separately.
+		IECore::InternedString computeCachePartition( const Gaffer::ValuePlug *output ) const override;
 
 		/// Returns `enabledPlug()->getValue()` evaluated in a global context.
 		/// Disabling is handled automatically by the SceneNode and SceneProcessor
@@ -55,6 +55,15 @@ GAFFERSCENE_API void setExpressionHash( const std::string &setExpression, const
 
 GAFFERSCENE_API bool affectsSetExpression( const Gaffer::Plug *scenePlugChild );
 
+/// Intermediate results of set expressions are cached, so that
+/// subexpressions shared between expressions are evaluated only once.
+/// The cache is limited by the total number of paths in the cached
+/// results, with each result also counting as one path regardless
+/// of its size.
+GAFFERSCENE_API void setExpressionResultCacheLimit( size_t limit );
+GAFFERSCENE_API size_t getExpressionResultCacheLimit();
+GAFFERSCENE_API size_t expressionResultCacheUsage();
+
 } // namespace SetAlgo
 
 } // namespace Gaffer
@@ -188,7 +188,10 @@ GAFFERTEST_API void testEditableScope();
 GAFFERTEST_API std::tuple<int,int,int,int> countContextHash32Collisions( int contexts, int mode, int seed );
 GAFFERTEST_API void testContextHashPerformance( int numEntries, int entrySize, bool startInitialized );
 GAFFERTEST_API void testContextCopyPerformance( int numEntries, int entrySize );
+GAFFERTEST_API void testContextSetPerformance();
+GAFFERTEST_API void testCancellableContextCopyPerformance( int numEntries );
 GAFFERTEST_API void testCopyEditableScope();
+GAFFERTEST_API void testInlineValueReferences();
 GAFFERTEST_API void testContextHashValidation();
 
 } // namespace GafferTest
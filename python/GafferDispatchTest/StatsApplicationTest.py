@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import json
 import inspect
 import unittest
 import subprocess
@@ -71,5 +72,49 @@ class StatsApplicationTest( GafferTest.TestCase ) :
 		self.assertIn( "valueOne 1", o )
 		self.assertIn( "valueTwo 2", o )
 
+	def testTraceFile( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add"] = GafferTest.AddNode()
+		script["add"]["op1"].setValue( 1 )
+		script["command"] = GafferDispatch.PythonCommand()
+		script["command"]["variables"].addChild( Gaffer.NameValuePlug( "sum", 0, flags = Gaffer.Plug.Flags.Default | Gaffer.Plug.Flags.Dynamic ) )
+		script["command"]["variables"][0]["value"].setInput( script["add"]["sum"] )
+		script["command"]["command"].setValue( "assert( variables['sum'] == 1 )" )
+
+		script["fileName"].setValue( self.temporaryDirectory() / "script.gfr" )
+		script.save()
+
+		traceFile = self.temporaryDirectory() / "trace.json"
+		subprocess.check_output(
+			[ str( Gaffer.executablePath() ), "stats", script["fileName"].getValue(), "-task", "command", "-traceFile", str( traceFile ) ],
+			universal_newlines = True
+		)
+
+		with open( traceFile ) as f :
+			trace = json.load( f )
+
+		# There must be a complete event for the compute of the AddNode,
+		# with a valid timestamp and duration.
+
+		computeEvents = [
+			e for e in trace["traceEvents"]
+			if e.get( "ph" ) == "X" and e["name"].endswith( "add.sum" ) and e["cat"] == "computeNode:compute"
+		]
+		self.assertGreaterEqual( len( computeEvents ), 1 )
+
+		event = computeEvents[0]
+		self.assertEqual( event["args"]["plug"], event["name"] )
+		self.assertIsInstance( event["ts"], ( int, float ) )
+		self.assertIsInstance( event["dur"], ( int, float ) )
+		self.assertGreaterEqual( event["ts"], 0 )
+		self.assertGreaterEqual( event["dur"], 0 )
+		self.assertIn( "tid", event )
+
+		# And each thread that recorded events must be named.
+
+		threadNames = { e["tid"] for e in trace["traceEvents"] if e.get( "ph" ) == "M" and e["name"] == "thread_name" }
+		self.assertIn( event["tid"], threadNames )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -41,6 +41,7 @@ import pathlib
 import IECore
 
 import Gaffer
+import GafferTest
 import GafferImage
 import GafferImageTest
 import os
@@ -198,5 +199,141 @@ class BlurTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( finalCrop["out"], expectedReader["out"], maxDifference = 0.00001, ignoreMetadata = True )
 
+	def testFastMode( self ) :
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "checkerWithNegativeDataWindow.200x150.exr" )
+
+		accurate = GafferImage.Blur()
+		accurate["in"].setInput( reader["out"] )
+
+		fast = GafferImage.Blur()
+		fast["in"].setInput( reader["out"] )
+		fast["mode"].setValue( GafferImage.Blur.Mode.Fast )
+		fast["radius"].setInput( accurate["radius"] )
+		fast["boundingMode"].setInput( accurate["boundingMode"] )
+
+		# Zero radius is a pass-through in both modes
+
+		self.assertImageHashesEqual( fast["out"], reader["out"] )
+
+		# Otherwise the box cascade is a close approximation
+		# to the gaussian.
+
+		for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+			for radius in [ imath.V2f( 3 ), imath.V2f( 20 ), imath.V2f( 40.5, 0 ), imath.V2f( 0, 60 ) ] :
+				with self.subTest( boundingMode = boundingMode, radius = radius ) :
+					accurate["boundingMode"].setValue( boundingMode )
+					accurate["radius"].setValue( radius )
+					self.assertImagesEqual( fast["out"], accurate["out"], maxDifference = 0.02 )
+
+	def testFastModeTileBoundaries( self ) :
+
+		# Shifting the input relative to the tile grid should
+		# just shift the output.
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.imagesPath() / "checkerWithNegativeDataWindow.200x150.exr" )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( reader["out"] )
+		blur["mode"].setValue( GafferImage.Blur.Mode.Fast )
+		blur["radius"].setValue( imath.V2f( 70, 45.5 ) )
+		blur["expandDataWindow"].setValue( True )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( reader["out"] )
+
+		offsetBlur = GafferImage.Blur()
+		offsetBlur["in"].setInput( offset["out"] )
+		offsetBlur["mode"].setInput( blur["mode"] )
+		offsetBlur["radius"].setInput( blur["radius"] )
+		offsetBlur["boundingMode"].setInput( blur["boundingMode"] )
+		offsetBlur["expandDataWindow"].setInput( blur["expandDataWindow"] )
+
+		reverseOffset = GafferImage.Offset()
+		reverseOffset["in"].setInput( offsetBlur["out"] )
+
+		for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+			for o in [ imath.V2i( 107, 136 ), imath.V2i( -37, 21 ), imath.V2i( -1070, 1360 ) ] :
+				with self.subTest( boundingMode = boundingMode, offset = o ) :
+					blur["boundingMode"].setValue( boundingMode )
+					offset["offset"].setValue( o )
+					reverseOffset["offset"].setValue( -o )
+					self.assertImagesEqual( reverseOffset["out"], blur["out"], maxDifference = 0.000001 )
+
+	def testFastModeEnergyPreservation( self ) :
+
+		constant = GafferImage.Constant()
+		constant["color"].setValue( imath.Color4f( 1 ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( constant["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 100 ), imath.V2i( 101 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( crop["out"] )
+		blur["mode"].setValue( GafferImage.Blur.Mode.Fast )
+		blur["expandDataWindow"].setValue( True )
+
+		stats = GafferImage.ImageStats()
+		stats["in"].setInput( blur["out"] )
+		stats["area"].setValue( imath.Box2i( imath.V2i( 0 ), imath.V2i( 200 ) ) )
+
+		for radius in [ 0.5, 1, 2.5, 10, 33.3, 60 ] :
+			blur["radius"].setValue( imath.V2f( radius ) )
+			self.assertAlmostEqual( stats["average"]["r"].getValue(), 1 / 40000., delta = 0.0000001 )
+
+	def testFastModeNonFiniteValues( self ) :
+
+		constant = GafferImage.Constant()
+		constant["format"].setValue( GafferImage.Format( 200, 200 ) )
+		constant["color"].setValue( imath.Color4f( 0.5 ) )
+
+		infinity = GafferImage.Constant()
+		infinity["format"].setValue( GafferImage.Format( 200, 200 ) )
+		infinity["color"].setValue( imath.Color4f( float( "inf" ) ) )
+
+		crop = GafferImage.Crop()
+		crop["in"].setInput( infinity["out"] )
+		crop["area"].setValue( imath.Box2i( imath.V2i( 100 ), imath.V2i( 101 ) ) )
+		crop["affectDisplayWindow"].setValue( False )
+
+		merge = GafferImage.Merge()
+		merge["in"][0].setInput( constant["out"] )
+		merge["in"][1].setInput( crop["out"] )
+		merge["operation"].setValue( GafferImage.Merge.Operation.Max )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( merge["out"] )
+		blur["mode"].setValue( GafferImage.Blur.Mode.Fast )
+		blur["radius"].setValue( imath.V2f( 10 ) )
+
+		# The infinite pixel spreads only as far as the filter reaches,
+		# rather than contaminating the rest of the image.
+
+		sampler = GafferImage.Sampler( blur["out"], "R", imath.Box2i( imath.V2i( 0 ), imath.V2i( 200 ) ) )
+		self.assertEqual( sampler.sample( 100, 100 ), float( "inf" ) )
+		self.assertAlmostEqual( sampler.sample( 150, 100 ), 0.5, places = 5 )
+		self.assertAlmostEqual( sampler.sample( 100, 150 ), 0.5, places = 5 )
+		self.assertAlmostEqual( sampler.sample( 150, 150 ), 0.5, places = 5 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testFastModePerf( self ) :
+
+		imageReader = GafferImage.ImageReader()
+		imageReader["fileName"].setValue( self.imagesPath() / "deepMergeReference.exr" )
+
+		GafferImageTest.processTiles( imageReader["out"] )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( imageReader["out"] )
+		blur["mode"].setValue( GafferImage.Blur.Mode.Fast )
+		blur["radius"].setValue( imath.V2f( 200 ) )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( blur["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
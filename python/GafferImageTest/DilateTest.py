@@ -383,8 +383,7 @@ class DilateTest( GafferImageTest.ImageTestCase ) :
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
 
-	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
-	def testPerf( self ) :
+	def __testPerf( self, radius ) :
 
 		imageReader = GafferImage.ImageReader()
 		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
@@ -393,10 +392,30 @@ class DilateTest( GafferImageTest.ImageTestCase ) :
 
 		dilate = GafferImage.Dilate()
 		dilate["in"].setInput( imageReader["out"] )
-		dilate["radius"].setValue( imath.V2i( 128 ) )
+		dilate["radius"].setValue( imath.V2i( radius ) )
 
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( dilate["out"] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerf( self ) :
+
+		self.__testPerf( 128 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius1( self ) :
+
+		self.__testPerf( 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius8( self ) :
+
+		self.__testPerf( 8 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius32( self ) :
+
+		self.__testPerf( 32 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -338,8 +338,7 @@ class ErodeTest( GafferImageTest.ImageTestCase ) :
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
 
-	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
-	def testPerf( self ) :
+	def __testPerf( self, radius ) :
 
 		imageReader = GafferImage.ImageReader()
 		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
@@ -348,10 +347,30 @@ class ErodeTest( GafferImageTest.ImageTestCase ) :
 
 		erode = GafferImage.Erode()
 		erode["in"].setInput( imageReader["out"] )
-		erode["radius"].setValue( imath.V2i( 128 ) )
+		erode["radius"].setValue( imath.V2i( radius ) )
 
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( erode["out"] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerf( self ) :
+
+		self.__testPerf( 128 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius1( self ) :
+
+		self.__testPerf( 1 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius8( self ) :
+
+		self.__testPerf( 8 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius32( self ) :
+
+		self.__testPerf( 32 )
+
 if __name__ == "__main__":
 	unittest.main()
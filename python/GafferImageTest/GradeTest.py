@@ -306,3 +306,34 @@ class GradeTest( GafferImageTest.ImageTestCase ) :
 		defaultGrade["gamma"].setValue( imath.Color4f( 2, 2, 2, 1.0 ) )
 
 		self.assertImagesEqual( unpremultipliedGrade["out"], defaultGrade["out"] )
+
+	def testUniformTiles( self ) :
+
+		constant1 = GafferImage.Constant()
+		constant1["color"].setValue( imath.Color4f( 0.25, 0.5, 0.75, 0.5 ) )
+
+		grade1 = GafferImage.Grade()
+		grade1["in"].setInput( constant1["out"] )
+		grade1["gain"].setValue( imath.Color4f( 2, 3, 4, 1 ) )
+		grade1["processUnpremultiplied"].setValue( True )
+
+		constant2 = GafferImage.Constant()
+		constant2["color"].setValue( imath.Color4f( 0.25, 0.75, 0.75, 0.5 ) )
+
+		grade2 = GafferImage.Grade()
+		grade2["in"].setInput( constant2["out"] )
+		grade2["gain"].setValue( imath.Color4f( 2, 2, 4, 1 ) )
+		grade2["processUnpremultiplied"].setValue( True )
+
+		# Constant input tiles are uniform, so the grades should produce
+		# uniform tiles, shared between all results with the same value.
+
+		tile1 = grade1["out"].channelData( "G", imath.V2i( 0 ), _copy = False )
+		tile2 = grade2["out"].channelData( "G", imath.V2i( 0 ), _copy = False )
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( tile1 ) )
+		self.assertEqual( len( tile1 ), GafferImage.ImagePlug.tilePixels() )
+		self.assertEqual( tile1[0], 0.75 )
+		self.assertTrue( tile1.isSame( tile2 ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -144,6 +144,44 @@ class ImageNodeTest( GafferImageTest.ImageTestCase ) :
 		assertExpectedImage( script2["dot"]["out"] )
 		self.assertEqual( script2["expression"].getExpression(), script["expression"].getExpression() )
 
+	def __evictionModePerformance( self, mode ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setCacheEvictionMode, Gaffer.ValuePlug.getCacheEvictionMode() )
+		Gaffer.ValuePlug.setCacheEvictionMode( mode )
+
+		# An expensive branch blurring with a large radius, and a cheap
+		# branch whose tiles will overflow the cache.
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1024, 1024 ) )
+
+		blur = GafferImage.Blur()
+		blur["in"].setInput( checkerboard["out"] )
+		blur["radius"].setValue( imath.V2f( 40 ) )
+
+		grade = GafferImage.Grade()
+		grade["in"].setInput( checkerboard["out"] )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.setCacheMemoryLimit( 64 * 1024 ** 2 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 5 ) :
+				GafferImageTest.processTiles( blur["out"] )
+				for j in range( 0, 20 ) :
+					grade["gain"].setValue( imath.Color4f( j + 1 ) )
+					GafferImageTest.processTiles( grade["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLRUEvictionPerformance( self ) :
+
+		self.__evictionModePerformance( Gaffer.ValuePlug.CacheEvictionMode.LRU )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testCostAwareEvictionPerformance( self ) :
+
+		self.__evictionModePerformance( Gaffer.ValuePlug.CacheEvictionMode.CostAware )
+
 	def setUp( self ) :
 
 		GafferImageTest.ImageTestCase.setUp( self )
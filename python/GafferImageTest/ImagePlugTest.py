@@ -297,6 +297,36 @@ class ImagePlugTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
 
+	def testUniformTile( self ) :
+
+		ts = GafferImage.ImagePlug.tileSize()
+		tileDataCopiedA = GafferImage.ImagePlug.uniformTile( 0.5 )
+		tileDataCopiedB = GafferImage.ImagePlug.uniformTile( 0.5 )
+		self.__testTileData( tileDataCopiedA, ts*ts, value = 0.5 )
+
+		self.assertFalse( tileDataCopiedA.isSame( tileDataCopiedB ) )
+
+		tileDataNoCopyA = GafferImage.ImagePlug.uniformTile( 0.5, _copy = False )
+		tileDataNoCopyB = GafferImage.ImagePlug.uniformTile( 0.5, _copy = False )
+		self.__testTileData( tileDataNoCopyA, ts*ts, value = 0.5 )
+
+		self.assertTrue( tileDataNoCopyA.isSame( tileDataNoCopyB ) )
+
+		self.assertTrue( GafferImage.ImagePlug.uniformTile( 0, _copy = False ).isSame( GafferImage.ImagePlug.blackTile( _copy = False ) ) )
+		self.assertTrue( GafferImage.ImagePlug.uniformTile( 1, _copy = False ).isSame( GafferImage.ImagePlug.whiteTile( _copy = False ) ) )
+
+	def testIsUniformTile( self ) :
+
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.blackTile() ) )
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.whiteTile() ) )
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.uniformTile( 2 ) ) )
+		self.assertTrue( GafferImage.ImagePlug.isUniformTile( IECore.FloatVectorData( [ 3 ] * 10 ) ) )
+		self.assertFalse( GafferImage.ImagePlug.isUniformTile( GafferImage.ImagePlug.emptyTile() ) )
+
+		tile = GafferImage.ImagePlug.uniformTile( 2 )
+		tile[-1] = 3
+		self.assertFalse( GafferImage.ImagePlug.isUniformTile( tile ) )
+
 	def __testTileData( self, tileData, numSamples, value = None, valueFunc = None ) :
 
 		self.assertEqual( len(tileData), numSamples )
@@ -1033,5 +1033,36 @@ class ImageReaderTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertNotIn( "multiView", reader["out"].metadata() )
 
+	def testChannelDataNotCached( self ) :
+
+		checker = GafferImage.Checkerboard()
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checker["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "half.exr" )
+		writer["openexr"]["dataType"].setValue( "half" )
+		writer["task"].execute()
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		def imageAndCacheMemory( halfPrecisionTileStorage ) :
+
+			GafferImage.OpenImageIOReader.setHalfPrecisionTileStorage( halfPrecisionTileStorage )
+			Gaffer.ValuePlug.clearCache()
+			return GafferImage.ImageAlgo.image( reader["out"] ), Gaffer.ValuePlug.cacheMemoryUsage()
+
+		try :
+			floatImage, floatMemory = imageAndCacheMemory( False )
+			halfImage, halfMemory = imageAndCacheMemory( True )
+		finally :
+			GafferImage.OpenImageIOReader.setHalfPrecisionTileStorage( False )
+
+		# The ImageReader passes through the tiles from its internal
+		# OpenImageIOReader, so must not store them in the cache again.
+		# If it did, half precision storage would save much less memory.
+		self.assertEqual( halfImage, floatImage )
+		self.assertLess( halfMemory, floatMemory * 0.6 )
+
 if __name__ == "__main__":
 	unittest.main()
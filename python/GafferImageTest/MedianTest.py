@@ -144,6 +144,40 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 			# a master
 			self.assertImagesEqual( masterMedianSingleChannel["out"], defaultMedianSingleChannel["out"] )
 
+	def testLargeRadii( self ) :
+
+		# Large radii are computed using a different algorithm, but the driver channel
+		# code path still uses the original one, so we can use it as a reference.
+
+		noise = OpenImageIO.ImageBufAlgo.noise( "gaussian", 0, 1, roi = OpenImageIO.ROI( 0, 150, 0, 130, 0, 1, 0, 1 ) )
+		noise.setpixel( 20, 30, 0, ( float( "nan" ), ) )
+		noise.setpixel( 21, 30, 0, ( float( "inf" ), ) )
+		noise.setpixel( 22, 30, 0, ( -float( "inf" ), ) )
+		noise.write( str( self.temporaryDirectory() / "noise.exr" ) )
+
+		reader = GafferImage.ImageReader()
+		reader["fileName"].setValue( self.temporaryDirectory() / "noise.exr" )
+
+		offset = GafferImage.Offset()
+		offset["in"].setInput( reader["out"] )
+		offset["offset"].setValue( imath.V2i( -37, 21 ) )
+
+		median = GafferImage.Median()
+		median["in"].setInput( offset["out"] )
+
+		driverMedian = GafferImage.Median()
+		driverMedian["in"].setInput( offset["out"] )
+		driverMedian["radius"].setInput( median["radius"] )
+		driverMedian["boundingMode"].setInput( median["boundingMode"] )
+		driverMedian["masterChannel"].setValue( "R" )
+
+		for boundingMode in GafferImage.Sampler.BoundingMode.values.values() :
+			for radius in [ imath.V2i( 3 ), imath.V2i( 4 ), imath.V2i( 9, 2 ), imath.V2i( 0, 20 ), imath.V2i( 33, 12 ), imath.V2i( 70 ) ] :
+				with self.subTest( boundingMode = boundingMode, radius = radius ) :
+					median["boundingMode"].setValue( boundingMode )
+					median["radius"].setValue( radius )
+					self.assertImagesEqual( median["out"], driverMedian["out"] )
+
 	def testCancellation( self ) :
 
 		script = Gaffer.ScriptNode()
@@ -362,8 +396,7 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 		reverseOffset["offset"].setValue( imath.V2i( 1070, -1360 ) )
 		self.assertImagesEqual( reverseOffset["out"], refReader["out"], ignoreMetadata = True )
 
-	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
-	def testPerf( self ) :
+	def __testPerf( self, radius ) :
 
 		imageReader = GafferImage.ImageReader()
 		imageReader["fileName"].setValue( self.imagesPath() / 'deepMergeReference.exr' )
@@ -372,10 +405,30 @@ class MedianTest( GafferImageTest.ImageTestCase ) :
 
 		median = GafferImage.Median()
 		median["in"].setInput( imageReader["out"] )
-		median["radius"].setValue( imath.V2i( 128 ) )
+		median["radius"].setValue( imath.V2i( radius ) )
 
 		with GafferTest.TestRunner.PerformanceScope() :
 			GafferImageTest.processTiles( median["out"] )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerf( self ) :
+
+		self.__testPerf( 128 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius2( self ) :
+
+		self.__testPerf( 2 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius8( self ) :
+
+		self.__testPerf( 8 )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testPerfRadius32( self ) :
+
+		self.__testPerf( 32 )
+
 if __name__ == "__main__":
 	unittest.main()
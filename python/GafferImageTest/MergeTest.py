@@ -843,6 +843,34 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 
 		self.assertImagesEqual( referenceShuf["out"], merge["out"], ignoreMetadata = True, ignoreChannelNamesOrder = True )
 
+	def testUniformTiles( self ) :
+
+		constantA = GafferImage.Constant()
+		constantA["format"].setValue( GafferImage.Format( 100, 100 ) )
+		constantA["color"].setValue( imath.Color4f( 0.5, 0.25, 0, 0.5 ) )
+
+		constantB = GafferImage.Constant()
+		constantB["format"].setValue( GafferImage.Format( 100, 100 ) )
+		constantB["color"].setValue( imath.Color4f( 0, 0.5, 1, 1 ) )
+
+		merge = GafferImage.Merge()
+		merge["in"][0].setInput( constantB["out"] )
+		merge["in"][1].setInput( constantA["out"] )
+		merge["operation"].setValue( GafferImage.Merge.Operation.Over )
+
+		# Tiles entirely inside the data window are uniform, and should be
+		# computed as such.
+
+		for channel, value in zip( "RGBA", ( 0.5, 0.5, 0.5, 1 ) ) :
+			tile = merge["out"].channelData( channel, imath.V2i( 0 ), _copy = False )
+			self.assertTrue( GafferImage.ImagePlug.isUniformTile( tile ) )
+			self.assertTrue( tile.isSame( GafferImage.ImagePlug.uniformTile( value, _copy = False ) ) )
+
+		# Tiles straddling the edge of the data window are not.
+
+		tile = merge["out"].channelData( "R", imath.V2i( 64 ), _copy = False )
+		self.assertFalse( GafferImage.ImagePlug.isUniformTile( tile ) )
+
 	def testMultiView( self ) :
 
 		c1 = GafferImage.Constant()
@@ -1117,5 +1145,40 @@ class MergeTest( GafferImageTest.ImageTestCase ) :
 	def testMaxMismatchPerf( self ):
 		self.mergePerf( GafferImage.Merge.Operation.Max, True )
 
+	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 5 )
+	def testManyInputsPerf( self ) :
+
+		# Lighting comps often merge dozens of AOVs or light groups in a single
+		# Merge, so that after the first input, every operation accumulates
+		# into the merge buffers. With 30 inputs of 1024x1024, each repeat merges
+		# 30 megapixels per channel.
+
+		checkerboard = GafferImage.Checkerboard()
+		checkerboard["format"].setValue( GafferImage.Format( 1024, 1024, 1.000 ) )
+		checkerboard["size"].setValue( imath.V2f( 64.01 ) )
+
+		alphaShuffle = GafferImage.Shuffle()
+		alphaShuffle["in"].setInput( checkerboard["out"] )
+		alphaShuffle["shuffles"].addChild( Gaffer.ShufflePlug( "R", "A" ) )
+
+		merge = GafferImage.Merge()
+		merge["operation"].setValue( GafferImage.Merge.Operation.Over )
+
+		offsets = []
+		for i in range( 0, 30 ) :
+			offset = GafferImage.Offset()
+			offset["in"].setInput( alphaShuffle["out"] )
+			offset["offset"].setValue( imath.V2i( i * 3, i * 5 ) )
+			merge["in"][i].setInput( offset["out"] )
+			offsets.append( offset )
+
+		# Precache upstream network, we're only interested in the performance of Merge
+		for offset in offsets :
+			GafferImageTest.processTiles( offset["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			GafferImageTest.processTiles( merge["out"] )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -738,6 +738,40 @@ class OpenImageIOReaderTest( GafferImageTest.ImageTestCase ) :
 		finally :
 			GafferImage.OpenImageIOReader.setOpenFilesLimit( l )
 
+	def testHalfPrecisionTileStorage( self ) :
+
+		checker = GafferImage.Checkerboard()
+
+		writer = GafferImage.ImageWriter()
+		writer["in"].setInput( checker["out"] )
+		writer["fileName"].setValue( self.temporaryDirectory() / "half.exr" )
+		writer["openexr"]["dataType"].setValue( "half" )
+		writer["task"].execute()
+
+		reader = GafferImage.OpenImageIOReader()
+		reader["fileName"].setInput( writer["fileName"] )
+
+		shuffle = GafferImage.Shuffle()
+		shuffle["in"].setInput( reader["out"] )
+		shuffle["shuffles"].addChild( Gaffer.ShufflePlug( "R", "A" ) )
+
+		self.assertFalse( GafferImage.OpenImageIOReader.getHalfPrecisionTileStorage() )
+
+		def imageAndCacheMemory( halfPrecisionTileStorage ) :
+
+			GafferImage.OpenImageIOReader.setHalfPrecisionTileStorage( halfPrecisionTileStorage )
+			Gaffer.ValuePlug.clearCache()
+			return GafferImage.ImageAlgo.image( shuffle["out"] ), Gaffer.ValuePlug.cacheMemoryUsage()
+
+		try :
+			floatImage, floatMemory = imageAndCacheMemory( False )
+			halfImage, halfMemory = imageAndCacheMemory( True )
+		finally :
+			GafferImage.OpenImageIOReader.setHalfPrecisionTileStorage( False )
+
+		self.assertEqual( halfImage, floatImage )
+		self.assertLess( halfMemory, floatMemory * 0.6 )
+
 	def testSubimageMetadataNotLoaded( self ) :
 
 		reader = GafferImage.ImageReader()
@@ -91,7 +91,28 @@ Gaffer.Metadata.registerNode(
 			which the blur will bleed onto.
 			"""
 
-		]
+		],
+
+		"mode" : [
+
+			"description",
+			"""
+			The method used to compute the blur.
+
+			- Accurate : Filters with a true gaussian. The cost
+			  increases in proportion to the radius.
+			- Fast : Approximates a gaussian using repeated box
+			  filters. The cost is almost independent of the radius,
+			  making this much faster for large blurs such as glows
+			  and blooms.
+			""",
+
+			"preset:Accurate", GafferImage.Blur.Mode.Accurate,
+			"preset:Fast", GafferImage.Blur.Mode.Fast,
+
+			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
+
+		],
 
 	}
 
@@ -39,6 +39,7 @@ import imath
 import IECore
 import IECoreScene
 
+import Gaffer
 import GafferTest
 import GafferScene
 import GafferSceneTest
@@ -289,5 +290,94 @@ class ClosestPointSamplerTest( GafferSceneTest.SceneTestCase ) :
 		prune["filter"].setInput( sphereFilter["out"] )
 		self.assertNotIn( "sampled:P", sampler["out"].object( "/plane" ) )
 
+	def testEvaluatorIsShared( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane*" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["target"].setValue( "/plane" )
+		duplicate["copies"].setValue( 10 )
+
+		samplers = []
+		for primitiveVariables in [ "P", "uv" ] :
+			sampler = GafferScene.ClosestPointSampler()
+			sampler["in"].setInput( duplicate["out"] )
+			sampler["source"].setInput( sphere["out"] )
+			sampler["filter"].setInput( planeFilter["out"] )
+			sampler["sourceLocation"].setValue( "/sphere" )
+			sampler["primitiveVariables"].setValue( primitiveVariables )
+			sampler["prefix"].setValue( "sampled:" )
+			samplers.append( sampler )
+
+		def assertEvaluatorComputeCount( count ) :
+
+			Gaffer.ValuePlug.clearCache()
+			with Gaffer.PerformanceMonitor() as monitor :
+				for sampler in samplers :
+					for location in sampler["out"].childNames( "/" ) :
+						self.assertIn( "sampled:" + sampler["primitiveVariables"].getValue(), sampler["out"].object( "/" + str( location ) ) )
+
+			self.assertEqual(
+				sum( monitor.plugStatistics( s["__sourceEvaluator"] ).computeCount for s in samplers ),
+				count
+			)
+
+		# All samplers and all destination locations share a single evaluator
+		# for the source sphere.
+		assertEvaluatorComputeCount( 1 )
+
+		# Unless the samplers are sampling different things.
+		samplers[1]["source"].setInput( plane["out"] )
+		samplers[1]["sourceLocation"].setValue( "/plane" )
+		assertEvaluatorComputeCount( 2 )
+
+	def testEvaluatorNotWrittenToDiskCache( self ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setDiskCacheDirectory, Gaffer.ValuePlug.getDiskCacheDirectory() )
+		cacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.addCleanup( Gaffer.ValuePlug.setCacheMemoryLimit, cacheMemoryLimit )
+		Gaffer.ValuePlug.setDiskCacheDirectory( str( self.temporaryDirectory() / "diskCache" ) )
+
+		sphere = GafferScene.Sphere()
+
+		plane = GafferScene.Plane()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["target"].setValue( "/plane" )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane*" ] ) )
+
+		sampler = GafferScene.ClosestPointSampler()
+		sampler["in"].setInput( duplicate["out"] )
+		sampler["source"].setInput( sphere["out"] )
+		sampler["filter"].setInput( planeFilter["out"] )
+		sampler["sourceLocation"].setValue( "/sphere" )
+		sampler["primitiveVariables"].setValue( "P" )
+		sampler["prefix"].setValue( "sampled:" )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertIn( "sampled:P", sampler["out"].object( "/plane" ) )
+
+		# Evict everything. Values that can be serialised are written to
+		# the disk cache, but the evaluator can't be.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+		Gaffer.ValuePlug.setCacheMemoryLimit( cacheMemoryLimit )
+		self.assertGreater( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		# So it must be recomputed when sampling another location.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertIn( "sampled:P", sampler["out"].object( "/plane1" ) )
+		self.assertEqual( monitor.plugStatistics( sampler["__sourceEvaluator"] ).computeCount, 1 )
+
 if __name__ == "__main__":
 	unittest.main()
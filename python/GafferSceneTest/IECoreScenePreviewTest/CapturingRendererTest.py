@@ -168,6 +168,32 @@ class CapturingRendererTest( GafferTest.TestCase ) :
 		self.assertEqual( c.capturedSamples(), [ sphere1, sphere2 ] )
 		self.assertEqual( c.capturedSampleTimes(), [ 1, 2 ] )
 
+	def testNumUniqueObjects( self ) :
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		self.assertEqual( renderer.numUniqueObjects(), 0 )
+
+		attributes = renderer.attributes( IECore.CompoundObject() )
+		sphere1 = IECoreScene.SpherePrimitive( 1 )
+		sphere2 = IECoreScene.SpherePrimitive( 2 )
+
+		o1 = renderer.object( "o1", sphere1, attributes )
+		o2 = renderer.object( "o2", sphere1.copy(), attributes )
+		self.assertEqual( renderer.numUniqueObjects(), 1 )
+
+		o3 = renderer.object( "o3", sphere2, attributes )
+		self.assertEqual( renderer.numUniqueObjects(), 2 )
+
+		# Deformation samples are distinct from any of the individual samples,
+		# and sample times are significant.
+
+		o4 = renderer.object( "o4", [ sphere1, sphere2 ], [ 1, 2 ], attributes )
+		o5 = renderer.object( "o5", [ sphere1, sphere2 ], [ 1, 2 ], attributes )
+		self.assertEqual( renderer.numUniqueObjects(), 3 )
+
+		o6 = renderer.object( "o6", [ sphere1, sphere2 ], [ 1, 3 ], attributes )
+		self.assertEqual( renderer.numUniqueObjects(), 4 )
+
 	class TestProcedural( GafferScene.Private.IECoreScenePreview.Procedural ) :
 
 		def __init__( self ) :
@@ -603,6 +603,60 @@ class MeshAlgoTessellateTest( GafferTest.TestCase ) :
 		)
 
 
+	def testMaxEdgeLength( self ) :
+
+		source = self.createTestData( 2 )
+
+		# A huge max edge length means no edges need dividing, and a tiny one means that every edge gets the
+		# maximum number of divisions - both match a uniform tessellation.
+		self.assertMeshesPracticallyEqual(
+			MeshAlgo.tessellateMesh( source, 3, maxEdgeLength = 10 ),
+			MeshAlgo.tessellateMesh( source, 0 ),
+			0.000002
+		)
+		self.assertMeshesPracticallyEqual(
+			MeshAlgo.tessellateMesh( source, 3, maxEdgeLength = 0.001 ),
+			MeshAlgo.tessellateMesh( source, 3 ),
+			0.000002
+		)
+
+		# Distort the grid so that edge lengths vary, giving a different number of divisions to each edge.
+		source = self.createTestData( 8 )
+		source["P"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.V3fVectorData( [ imath.V3f( p[0] * abs( p[0] ), p[1] * abs( p[1] ), 0 ) for p in source["P"].data ] )
+		)
+
+		for scheme in [ "catmullClark", "bilinear" ] :
+			with self.subTest( scheme = scheme ) :
+
+				uniform = MeshAlgo.tessellateMesh( source, 7, scheme = scheme )
+				adaptive = MeshAlgo.tessellateMesh( source, 7, scheme = scheme, maxEdgeLength = 0.05 )
+
+				self.assertTrue( adaptive.arePrimitiveVariablesValid() )
+				self.assertLess( adaptive.variableSize( IECoreScene.PrimitiveVariable.Interpolation.Vertex ), uniform.variableSize( IECoreScene.PrimitiveVariable.Interpolation.Vertex ) )
+				self.assertLess( adaptive.numFaces(), uniform.numFaces() )
+
+				# The output must be watertight : the only edges used by a single face should be those on
+				# the border of the grid.
+				edgeUses = {}
+				offset = 0
+				for n in adaptive.verticesPerFace :
+					self.assertIn( n, [ 3, 4 ] )
+					for i in range( n ) :
+						edge = tuple( sorted( ( adaptive.vertexIds[offset + i], adaptive.vertexIds[offset + ( i + 1 ) % n] ) ) )
+						edgeUses[edge] = edgeUses.get( edge, 0 ) + 1
+					offset += n
+
+				for edge, uses in edgeUses.items() :
+					if uses == 1 :
+						a, b = [ adaptive["P"].data[v] for v in edge ]
+						self.assertTrue(
+							( abs( a[0] ) > 0.999 and abs( b[0] ) > 0.999 ) or ( abs( a[1] ) > 0.999 and abs( b[1] ) > 0.999 )
+						)
+					else :
+						self.assertEqual( uses, 2 )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testSmallSourcePerf( self ):
 
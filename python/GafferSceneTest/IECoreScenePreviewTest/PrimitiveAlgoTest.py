@@ -672,6 +672,41 @@ class PrimitiveAlgoTest( GafferTest.TestCase ) :
 			{'labelSource', 'uv', 'indexedVertex', 'stringConstant', 'altUv', 'indexedUniform', 'N', 'unindexedUniform', 'unindexedFaceVarying'}
 		)
 
+	def testMergeLargeMeshes( self ) :
+
+		# Large enough that elements are copied in parallel.
+
+		mesh = IECoreScene.MeshPrimitive.createPlane(
+			imath.Box2f( imath.V2f( -2 ), imath.V2f( 2 ) ),
+			divisions = imath.V2i( 200, 200 )
+		)
+		mesh["N"] = IECoreScene.PrimitiveVariable(
+			Interpolation.Vertex,
+			IECore.V3fVectorData( [ imath.V3f( 0, 0, 1 ) ] * mesh.variableSize( Interpolation.Vertex ), IECore.GeometricData.Interpretation.Normal )
+		)
+		mesh["indexedUV"] = IECoreScene.PrimitiveVariable(
+			Interpolation.FaceVarying,
+			IECore.V2fVectorData( [ imath.V2f( 0 ), imath.V2f( 1 ) ] ),
+			IECore.IntVectorData( [ i % 2 for i in range( 0, mesh.variableSize( Interpolation.FaceVarying ) ) ] )
+		)
+
+		m = imath.M44f()
+		m.translate( imath.V3f( 0, 10, 0 ) )
+
+		merged = PrimitiveAlgo.mergePrimitives( [ ( mesh, imath.M44f() ), ( mesh, m ) ] )
+		self.assertTrue( merged.arePrimitiveVariablesValid() )
+
+		numVertices = mesh.variableSize( Interpolation.Vertex )
+		numFaceVertices = mesh.variableSize( Interpolation.FaceVarying )
+
+		self.assertEqual( list( merged["P"].data )[:numVertices], list( mesh["P"].data ) )
+		self.assertEqual( list( merged["P"].data )[numVertices:], [ p + imath.V3f( 0, 10, 0 ) for p in mesh["P"].data ] )
+		self.assertEqual( list( merged["N"].data ), [ imath.V3f( 0, 0, 1 ) ] * numVertices * 2 )
+
+		self.assertEqual( list( merged["indexedUV"].data ), [ imath.V2f( 0 ), imath.V2f( 1 ) ] * 2 )
+		self.assertEqual( list( merged["indexedUV"].indices )[:numFaceVertices], list( mesh["indexedUV"].indices ) )
+		self.assertEqual( list( merged["indexedUV"].indices )[numFaceVertices:], [ i + 2 for i in mesh["indexedUV"].indices ] )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testMergeManyPerf( self ) :
 
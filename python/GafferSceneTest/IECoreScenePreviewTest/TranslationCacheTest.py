@@ -0,0 +1,132 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import imath
+import unittest
+
+import IECore
+import IECoreScene
+
+import GafferTest
+import GafferScene
+
+class TranslationCacheTest( GafferTest.TestCase ) :
+
+	def setUp( self ) :
+
+		GafferTest.TestCase.setUp( self )
+
+		TranslationCache = GafferScene.Private.IECoreScenePreview.TranslationCache
+		self.addCleanup( TranslationCache.setMemoryLimit, TranslationCache.getMemoryLimit() )
+		TranslationCache.clear()
+		TranslationCache.resetStatistics()
+
+	def testGet( self ) :
+
+		TranslationCache = GafferScene.Private.IECoreScenePreview.TranslationCache
+
+		calls = []
+		def translator() :
+			calls.append( 1 )
+			return IECoreScene.MeshPrimitive.createPlane( imath.Box2f( imath.V2f( 0 ), imath.V2f( 1 ) ) )
+
+		key = IECore.MurmurHash()
+		key.append( "testGet" )
+
+		m1 = TranslationCache.get( key, translator )
+		m2 = TranslationCache.get( key, translator )
+		self.assertEqual( len( calls ), 1 )
+		self.assertEqual( m1, m2 )
+		self.assertFalse( m1.isSame( m2 ) )
+		self.assertGreater( TranslationCache.memoryUsage(), 0 )
+
+		statistics = TranslationCache.statistics()
+		self.assertEqual( statistics.hits, 1 )
+		self.assertEqual( statistics.misses, 1 )
+
+		# Results are copied, so that modifying them in Python
+		# can't modify the cached value.
+		del m1["P"]
+		self.assertEqual( TranslationCache.get( key, translator ), m2 )
+		self.assertEqual( len( calls ), 1 )
+
+		key.append( "different" )
+		TranslationCache.get( key, translator )
+		self.assertEqual( len( calls ), 2 )
+
+		TranslationCache.clear()
+		self.assertEqual( TranslationCache.memoryUsage(), 0 )
+		TranslationCache.get( key, translator )
+		self.assertEqual( len( calls ), 3 )
+
+	def testMemoryLimit( self ) :
+
+		TranslationCache = GafferScene.Private.IECoreScenePreview.TranslationCache
+		TranslationCache.setMemoryLimit( 0 )
+		self.assertEqual( TranslationCache.getMemoryLimit(), 0 )
+
+		calls = []
+		def translator() :
+			calls.append( 1 )
+			return IECore.IntVectorData( range( 0, 1000 ) )
+
+		TranslationCache.get( IECore.MurmurHash(), translator )
+		TranslationCache.get( IECore.MurmurHash(), translator )
+		self.assertEqual( len( calls ), 2 )
+		self.assertEqual( TranslationCache.memoryUsage(), 0 )
+
+	def testSamplesHash( self ) :
+
+		TranslationCache = GafferScene.Private.IECoreScenePreview.TranslationCache
+
+		sphere1 = IECoreScene.SpherePrimitive( 1 )
+		sphere2 = IECoreScene.SpherePrimitive( 2 )
+
+		self.assertEqual( TranslationCache.samplesHash( [ sphere1 ], [] ), sphere1.hash() )
+		self.assertEqual( TranslationCache.samplesHash( [ sphere1 ], [] ), TranslationCache.samplesHash( [ sphere1.copy() ], [] ) )
+		self.assertNotEqual( TranslationCache.samplesHash( [ sphere1 ], [] ), TranslationCache.samplesHash( [ sphere2 ], [] ) )
+
+		self.assertEqual(
+			TranslationCache.samplesHash( [ sphere1, sphere2 ], [ 0, 1 ] ),
+			TranslationCache.samplesHash( [ sphere1.copy(), sphere2.copy() ], [ 0, 1 ] )
+		)
+		self.assertNotEqual(
+			TranslationCache.samplesHash( [ sphere1, sphere2 ], [ 0, 1 ] ),
+			TranslationCache.samplesHash( [ sphere1, sphere2 ], [ 0, 2 ] )
+		)
+
+if __name__ == "__main__":
+	unittest.main()
@@ -40,6 +40,7 @@ from .PlaceholderTest import PlaceholderTest
 from .RendererTest import RendererTest
 from .MeshAlgoTessellateTest import MeshAlgoTessellateTest
 from .PrimitiveAlgoTest import PrimitiveAlgoTest
+from .TranslationCacheTest import TranslationCacheTest
 
 if __name__ == "__main__":
 	import unittest
@@ -2990,6 +2990,43 @@ parent["radius"] = ( 2 + context.getFrame() ) * 15
 		with GafferTest.TestRunner.PerformanceScope() :
 			instancer["out"].bound( "/sphere/instances/cube" )
 
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 10 )
+	def testTransformPerformance( self ) :
+
+		# Roughly one million points, with position, orientation and
+		# non-uniform scale, so that the timing is representative of the
+		# cost of building instance transforms per million points.
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 1000 ) )
+
+		filter = GafferScene.PathFilter()
+		filter["paths"].setValue( IECore.StringVectorData( [ '/sphere' ] ) )
+
+		orient = GafferScene.Orientation()
+		orient["in"].setInput( sphere["out"] )
+		orient["filter"].setInput( filter["out"] )
+		orient["randomEnabled"].setValue( True )
+		orient["randomSpread"].setValue( 180.0 )
+		orient["randomTwist"].setValue( 180.0 )
+
+		cube = GafferScene.Cube()
+		cube["transform"]["rotate"]["y"].setValue( 45 )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( orient["out"] )
+		instancer["filter"].setInput( filter["out"] )
+		instancer["prototypes"].setInput( cube["out"] )
+		instancer["orientation"].setValue( "orientation" )
+		# Any Vertex V3f primitive variable will do for measuring performance.
+		instancer["scale"].setValue( "P" )
+
+		GafferSceneTest.traverseScene( orient["out"] )
+		GafferSceneTest.traverseScene( cube["out"] )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			instancer["out"].bound( "/sphere/instances/cube" )
+
 	@unittest.skipIf( GafferTest.inCI(), "Performance not relevant on CI platform" )
 	@GafferTest.TestRunner.CategorisedTestMethod( { "expensivePerformance" } )
 	@GafferTest.TestRunner.PerformanceTestMethod()
@@ -3014,6 +3051,57 @@ parent["radius"] = ( 2 + context.getFrame() ) * 15
 	def testContextSetPerfWithVariationsParallelEvaluate( self ):
 		self.runTestContextSetPerf( True, True )
 
+	def testEncapsulatedBoundDoesNotSplitPrototypes( self ) :
+
+		points = IECoreScene.PointsPrimitive( IECore.V3fVectorData( [ imath.V3f( i, i % 3, 0 ) for i in range( 0, 10 ) ] ) )
+		points["index"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ 0, 1, 2 ] * 3 + [ 1 ] ) )
+		points["orientation"] = IECoreScene.PrimitiveVariable(
+			IECoreScene.PrimitiveVariable.Interpolation.Vertex,
+			IECore.QuatfVectorData( [ imath.Quatf().setAxisAngle( imath.V3f( 0, 1, 0 ), i ) for i in range( 0, 10 ) ] )
+		)
+		points["scale"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.FloatVectorData( [ 1 + i * 0.5 for i in range( 0, 10 ) ] ) )
+		points["id"] = IECoreScene.PrimitiveVariable( IECoreScene.PrimitiveVariable.Interpolation.Vertex, IECore.IntVectorData( [ 0, 1, 2, 3, 4, 5, 6, 7, 7, 9 ] ) )
+
+		objectToScene = GafferScene.ObjectToScene()
+		objectToScene["object"].setValue( points )
+
+		sphere = GafferScene.Sphere()
+		cube = GafferScene.Cube()
+		cube["transform"]["translate"]["y"].setValue( 2 )
+		plane = GafferScene.Plane()
+
+		prototypes = GafferScene.Parent()
+		prototypes["in"].setInput( sphere["out"] )
+		prototypes["children"][0].setInput( cube["out"] )
+		prototypes["children"][1].setInput( plane["out"] )
+		prototypes["parent"].setValue( "/" )
+
+		filter = GafferScene.PathFilter()
+		filter["paths"].setValue( IECore.StringVectorData( [ "/object" ] ) )
+
+		instancer = GafferScene.Instancer()
+		instancer["in"].setInput( objectToScene["out"] )
+		instancer["prototypes"].setInput( prototypes["out"] )
+		instancer["filter"].setInput( filter["out"] )
+		instancer["prototypeIndex"].setValue( "index" )
+		instancer["orientation"].setValue( "orientation" )
+		instancer["scale"].setValue( "scale" )
+		instancer["id"].setValue( "id" )
+		instancer["omitDuplicateIds"].setValue( True )
+
+		expandedBound = instancer["out"].bound( "/object/instances" )
+		self.assertEqual( expandedBound, instancer["out"].childBounds( "/object/instances" ) )
+
+		instancer["encapsulate"].setValue( True )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			self.assertEqual( instancer["out"].bound( "/object/instances" ), expandedBound )
+			self.assertEqual( instancer["out"].object( "/object/instances" ).bound(), expandedBound )
+
+		self.assertEqual( monitor.plugStatistics( instancer["__engineSplitPrototypes"] ).computeCount, 0 )
+
 	def initSimpleInstancer( self, withPrototypes = False, withIds = False ):
 		mesh = IECoreScene.MeshPrimitive.createPlane(
 			imath.Box2f( imath.V2f( -1 ), imath.V2f( 1 ) ),
@@ -849,6 +849,61 @@ class MergeMeshesTest( GafferSceneTest.SceneTestCase ) :
 		with GafferTest.TestRunner.PerformanceScope():
 			mergeMeshes["out"].object( "/merged" )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformanceManySmallMeshes( self ) :
+
+		plane = GafferScene.Plane()
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["filter"].setInput( planeFilter["out"] )
+		duplicate["copies"].setValue( 50000 )
+		duplicate["transform"]["translate"]["x"].setValue( 1 )
+
+		allFilter = GafferScene.PathFilter()
+		allFilter["paths"].setValue( IECore.StringVectorData( [ "*" ] ) )
+
+		mergeMeshes = GafferScene.MergeMeshes()
+		mergeMeshes["in"].setInput( duplicate["out"] )
+		mergeMeshes["filter"].setInput( allFilter["out"] )
+		mergeMeshes["destination"].setValue( "/merged" )
+
+		GafferSceneTest.traverseScene( mergeMeshes["in"] )
+
+		with GafferTest.TestRunner.PerformanceScope():
+			mergeMeshes["out"].object( "/merged" )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testPerformanceFewLargeMeshes( self ) :
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 2000 ) )
+
+		planeFilter = GafferScene.PathFilter()
+		planeFilter["paths"].setValue( IECore.StringVectorData( [ "/plane" ] ) )
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( plane["out"] )
+		duplicate["filter"].setInput( planeFilter["out"] )
+		duplicate["copies"].setValue( 3 )
+		duplicate["transform"]["translate"]["x"].setValue( 1 )
+
+		allFilter = GafferScene.PathFilter()
+		allFilter["paths"].setValue( IECore.StringVectorData( [ "*" ] ) )
+
+		mergeMeshes = GafferScene.MergeMeshes()
+		mergeMeshes["in"].setInput( duplicate["out"] )
+		mergeMeshes["filter"].setInput( allFilter["out"] )
+		mergeMeshes["destination"].setValue( "/merged" )
+
+		GafferSceneTest.traverseScene( mergeMeshes["in"] )
+
+		with GafferTest.TestRunner.PerformanceScope():
+			mergeMeshes["out"].object( "/merged" )
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testPerformanceUnprocessedLocations( self ) :
 		plane = GafferScene.Plane()
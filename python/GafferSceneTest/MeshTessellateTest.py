@@ -69,6 +69,7 @@ class MeshTessellateTest( GafferSceneTest.SceneTestCase ) :
 				interpolateBoundary = node["interpolateBoundary"].getValue(),
 				faceVaryingLinearInterpolation = node["faceVaryingLinearInterpolation"].getValue(),
 				triangleSubdivisionRule = node["triangleSubdivisionRule"].getValue(),
+				maxEdgeLength = node["maxEdgeLength"].getValue(),
 			)
 
 		self.assertEqual( node["out"].object( path ), reference )
@@ -168,6 +169,9 @@ class MeshTessellateTest( GafferSceneTest.SceneTestCase ) :
 			self.assertNodeCorrect( tessellate, "object" )
 			self.assertEqual( tessellate["out"].object("/object"), defaultTessellate["out"].object("/object") )
 
+		tessellate["maxEdgeLength"].setValue( 0.1 )
+		self.assertNodeCorrect( tessellate, "object" )
+
 
 if __name__ == "__main__":
 	unittest.main()
@@ -916,6 +916,57 @@ class ParentTest( GafferSceneTest.SceneTestCase ) :
 			parent["in"].boundHash( "/GAFFERBOT/C_torso_GRP" )
 		)
 
+	def testBoundDoesNotVisitPassThroughChildren( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 100 )
+		duplicate["transform"]["translate"]["x"].setValue( 2 )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( duplicate["out"] )
+
+		cube = GafferScene.Cube()
+		cube["transform"]["translate"]["y"].setValue( 10 )
+
+		parent = GafferScene.Parent()
+		parent["in"].setInput( group["out"] )
+		parent["children"][0].setInput( cube["out"] )
+		parent["parent"].setValue( "/group/sphere50" )
+
+		self.assertSceneValid( parent["out"] )
+
+		# Bounds must account for the new child, and all the
+		# existing children we pass through.
+
+		self.assertEqual(
+			parent["out"].bound( "/group" ),
+			parent["out"].childBounds( "/group" )
+		)
+		self.assertTrue( parent["out"].bound( "/group" ).intersects( imath.V3f( 200, 0, 0 ) ) )
+		self.assertTrue( parent["out"].bound( "/group" ).intersects( imath.V3f( 100, 10, 0 ) ) )
+
+		# But computing the bound of `/group` should only need to
+		# visit the child that leads to the new branch.
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache()
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			parent["out"].bound( "/group" )
+
+		self.assertEqual( monitor.plugStatistics( parent["out"]["childBounds"] ).computeCount, 1 )
+		self.assertLess( monitor.plugStatistics( parent["out"]["bound"] ).hashCount, 10 )
+
+		# And edits to the new child must still be reflected in the bound.
+
+		cube["transform"]["translate"]["y"].setValue( 20 )
+		self.assertTrue( parent["out"].bound( "/group" ).intersects( imath.V3f( 100, 20, 0 ) ) )
+		self.assertSceneValid( parent["out"] )
+
 	def testInvalidDestinationNames( self ) :
 
 		sphere = GafferScene.Sphere()
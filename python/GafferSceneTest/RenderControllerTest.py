@@ -271,6 +271,87 @@ class RenderControllerTest( GafferSceneTest.SceneTestCase ) :
 
 		del capturedSphere, capturedLightA, capturedLightB
 
+	def testSetEditsOnlyRelinkAffectedObjects( self ) :
+
+		sphereA = GafferScene.Sphere()
+		sphereA["name"].setValue( "sphereA" )
+
+		attributesA = GafferScene.StandardAttributes()
+		attributesA["in"].setInput( sphereA["out"] )
+		attributesA["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributesA["attributes"]["linkedLights"]["value"].setValue( "A" )
+
+		sphereB = GafferScene.Sphere()
+		sphereB["name"].setValue( "sphereB" )
+
+		attributesB = GafferScene.StandardAttributes()
+		attributesB["in"].setInput( sphereB["out"] )
+		attributesB["attributes"]["linkedLights"]["enabled"].setValue( True )
+		attributesB["attributes"]["linkedLights"]["value"].setValue( "B" )
+
+		lightA = GafferSceneTest.TestLight()
+		lightA["name"].setValue( "lightA" )
+		lightA["sets"].setValue( "A" )
+
+		lightB = GafferSceneTest.TestLight()
+		lightB["name"].setValue( "lightB" )
+		lightB["sets"].setValue( "B" )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( attributesA["out"] )
+		group["in"][1].setInput( attributesB["out"] )
+		group["in"][2].setInput( lightA["out"] )
+		group["in"][3].setInput( lightB["out"] )
+
+		setNode = GafferScene.Set()
+		setNode["in"].setInput( group["out"] )
+		setNode["mode"].setValue( setNode.Mode.Add )
+		setNode["name"].setValue( "C" )
+		setNode["paths"].setValue( IECore.StringVectorData( [ "/group/sphereA" ] ) )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer()
+		controller = GafferScene.RenderController( setNode["out"], Gaffer.Context(), renderer )
+		controller.setMinimumExpansionDepth( 10 )
+		controller.update()
+
+		capturedSphereA = renderer.capturedObject( "/group/sphereA" )
+		capturedSphereB = renderer.capturedObject( "/group/sphereB" )
+		capturedLightA = renderer.capturedObject( "/group/lightA" )
+		capturedLightB = renderer.capturedObject( "/group/lightB" )
+
+		self.assertEqual( capturedSphereA.capturedLinks( "lights" ), { capturedLightA } )
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 1 )
+		self.assertEqual( capturedSphereB.capturedLinks( "lights" ), { capturedLightB } )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 1 )
+
+		# Editing a set that doesn't affect the lights matched by either
+		# linking expression shouldn't relink anything.
+
+		setNode["paths"].setValue( IECore.StringVectorData( [ "/group/sphereB" ] ) )
+		controller.update()
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 1 )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 1 )
+
+		# Adding `lightB` to set "A" should relink only `sphereA`.
+
+		setNode["name"].setValue( "A" )
+		setNode["paths"].setValue( IECore.StringVectorData( [ "/group/lightB" ] ) )
+		controller.update()
+		self.assertEqual( capturedSphereA.capturedLinks( "lights" ), None )
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 2 )
+		self.assertEqual( capturedSphereB.capturedLinks( "lights" ), { capturedLightB } )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 1 )
+
+		# And removing it again should do the same.
+
+		setNode["enabled"].setValue( False )
+		controller.update()
+		self.assertEqual( capturedSphereA.capturedLinks( "lights" ), { capturedLightA } )
+		self.assertEqual( capturedSphereA.numLinkEdits( "lights" ), 3 )
+		self.assertEqual( capturedSphereB.numLinkEdits( "lights" ), 1 )
+
+		del capturedSphereA, capturedSphereB, capturedLightA, capturedLightB
+
 	@GafferTest.TestRunner.PerformanceTestMethod()
 	def testLightLinkPerformance( self ) :
 
@@ -925,5 +925,139 @@ class RendererAlgoTest( GafferSceneTest.SceneTestCase ) :
 					else :
 						self.assertIsNone( capsuleRenderer.capturedObject( f"/{purpose}/cube" ) )
 
+	def testOutputObjectsReleaseObjects( self ) :
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 200 ) )
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( sphere["out"] )
+
+		for releaseObjects in ( False, True ) :
+
+			with self.subTest( releaseObjects = releaseObjects ) :
+
+				Gaffer.ValuePlug.clearCache()
+
+				renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+					GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+				)
+				GafferScene.Private.RendererAlgo.outputObjects(
+					group["out"], GafferScene.Private.RendererAlgo.RenderOptions( group["out"] ),
+					GafferScene.Private.RendererAlgo.RenderSets( group["out"] ), GafferScene.Private.RendererAlgo.LightLinks(),
+					renderer, releaseObjects = releaseObjects
+				)
+				self.assertIsNotNone( renderer.capturedObject( "/group/sphere" ) )
+
+				# If the objects were released, pulling on the object again
+				# must recompute it. Otherwise it should come from the cache.
+
+				with Gaffer.PerformanceMonitor() as monitor :
+					group["out"].object( "/group/sphere" )
+
+				self.assertEqual(
+					monitor.plugStatistics( sphere["out"]["object"] ).computeCount,
+					1 if releaseObjects else 0
+				)
+
+	def testOutputObjectsReleaseSharedObjects( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 100 )
+
+		# Make sure the sphere is in the cache, so that we can check
+		# it isn't recomputed during output.
+		Gaffer.ValuePlug.clearCache()
+		duplicate["out"].object( "/sphere" )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferScene.Private.RendererAlgo.outputObjects(
+				duplicate["out"], GafferScene.Private.RendererAlgo.RenderOptions( duplicate["out"] ),
+				GafferScene.Private.RendererAlgo.RenderSets( duplicate["out"] ), GafferScene.Private.RendererAlgo.LightLinks(),
+				renderer, releaseObjects = True
+			)
+
+		self.assertIsNotNone( renderer.capturedObject( "/sphere" ) )
+		for i in range( 1, 101 ) :
+			self.assertIsNotNone( renderer.capturedObject( "/sphere{}".format( i ) ) )
+
+		# The sphere is shared by all the copies, so must not have been
+		# released until the last of them was output.
+		self.assertEqual( monitor.plugStatistics( sphere["out"]["object"] ).computeCount, 0 )
+
+		# But it should have been released after that.
+		with Gaffer.PerformanceMonitor() as monitor :
+			duplicate["out"].object( "/sphere" )
+		self.assertEqual( monitor.plugStatistics( sphere["out"]["object"] ).computeCount, 1 )
+
+	def testOutputObjectsReleaseObjectsSharedWithSkippedLocations( self ) :
+
+		# /sphere    (output)
+		# /sphere1   (camera)
+		# /sphere2   (excluded purpose)
+		# /sphere3   (invisible)
+
+		sphere = GafferScene.Sphere()
+
+		duplicate = GafferScene.Duplicate()
+		duplicate["in"].setInput( sphere["out"] )
+		duplicate["target"].setValue( "/sphere" )
+		duplicate["copies"].setValue( 3 )
+
+		cameraSet = GafferScene.Set()
+		cameraSet["in"].setInput( duplicate["out"] )
+		cameraSet["name"].setValue( "__cameras" )
+		cameraSet["paths"].setValue( IECore.StringVectorData( [ "/sphere1" ] ) )
+
+		purposeFilter = GafferScene.PathFilter()
+		purposeFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere2" ] ) )
+
+		purposeAttributes = GafferScene.CustomAttributes()
+		purposeAttributes["in"].setInput( cameraSet["out"] )
+		purposeAttributes["filter"].setInput( purposeFilter["out"] )
+		purposeAttributes["attributes"].addChild( Gaffer.NameValuePlug( "usd:purpose", "proxy" ) )
+
+		visibilityFilter = GafferScene.PathFilter()
+		visibilityFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere3" ] ) )
+
+		visibilityAttributes = GafferScene.CustomAttributes()
+		visibilityAttributes["in"].setInput( purposeAttributes["out"] )
+		visibilityAttributes["filter"].setInput( visibilityFilter["out"] )
+		visibilityAttributes["attributes"].addChild( Gaffer.NameValuePlug( "scene:visible", False ) )
+
+		scene = visibilityAttributes["out"]
+
+		Gaffer.ValuePlug.clearCache()
+		scene.object( "/sphere" )
+
+		renderer = GafferScene.Private.IECoreScenePreview.CapturingRenderer(
+			GafferScene.Private.IECoreScenePreview.Renderer.RenderType.Batch
+		)
+		with Gaffer.PerformanceMonitor() as monitor :
+			GafferScene.Private.RendererAlgo.outputObjects(
+				scene, GafferScene.Private.RendererAlgo.RenderOptions( scene ),
+				GafferScene.Private.RendererAlgo.RenderSets( scene ), GafferScene.Private.RendererAlgo.LightLinks(),
+				renderer, releaseObjects = True
+			)
+
+		self.assertIsNotNone( renderer.capturedObject( "/sphere" ) )
+		for name in [ "/sphere1", "/sphere2", "/sphere3" ] :
+			self.assertIsNone( renderer.capturedObject( name ) )
+		self.assertEqual( monitor.plugStatistics( sphere["out"]["object"] ).computeCount, 0 )
+
+		# Even though only one of the locations output the sphere, all of
+		# them must have given up their use of it, so it must have been released.
+
+		with Gaffer.PerformanceMonitor() as monitor :
+			scene.object( "/sphere" )
+		self.assertEqual( monitor.plugStatistics( sphere["out"]["object"] ).computeCount, 1 )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -493,6 +493,47 @@ class SceneNodeTest( GafferSceneTest.SceneTestCase ) :
 		assertExpectedScene( script2["dot"]["out"] )
 		self.assertEqual( script2["expression"].getExpression(), script["expression"].getExpression() )
 
+	def __evictionModePerformance( self, mode ) :
+
+		self.addCleanup( Gaffer.ValuePlug.setCacheEvictionMode, Gaffer.ValuePlug.getCacheEvictionMode() )
+		Gaffer.ValuePlug.setCacheEvictionMode( mode )
+
+		# An expensive branch producing a dense mesh with tangents, and a
+		# cheap branch producing large planes that will overflow the cache.
+
+		sphere = GafferScene.Sphere()
+		sphere["divisions"].setValue( imath.V2i( 500, 1000 ) )
+
+		pathFilter = GafferScene.PathFilter()
+		pathFilter["paths"].setValue( IECore.StringVectorData( [ "/sphere" ] ) )
+
+		tangents = GafferScene.MeshTangents()
+		tangents["in"].setInput( sphere["out"] )
+		tangents["filter"].setInput( pathFilter["out"] )
+
+		plane = GafferScene.Plane()
+		plane["divisions"].setValue( imath.V2i( 500 ) )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.setCacheMemoryLimit( 200 * 1024 ** 2 )
+
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 5 ) :
+				GafferSceneTest.traverseScene( tangents["out"] )
+				for j in range( 0, 20 ) :
+					plane["dimensions"].setValue( imath.V2f( j + 1 ) )
+					GafferSceneTest.traverseScene( plane["out"] )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testLRUEvictionPerformance( self ) :
+
+		self.__evictionModePerformance( Gaffer.ValuePlug.CacheEvictionMode.LRU )
+
+	@GafferTest.TestRunner.PerformanceTestMethod( repeat = 1 )
+	def testCostAwareEvictionPerformance( self ) :
+
+		self.__evictionModePerformance( Gaffer.ValuePlug.CacheEvictionMode.CostAware )
+
 	def setUp( self ) :
 
 		GafferSceneTest.SceneTestCase.setUp( self )
@@ -331,10 +331,76 @@ class SetAlgoTest( GafferSceneTest.SceneTestCase ) :
 
 		self.assertFalse( GafferScene.SetAlgo.affectsSetExpression( Gaffer.IntPlug() ) )
 
+	def testRepeatedEvaluation( self ) :
+
+		plane = GafferScene.Plane()
+		sphere = GafferScene.Sphere()
+		cube = GafferScene.Cube()
+
+		group = GafferScene.Group()
+		group["in"][0].setInput( plane["out"] )
+		group["in"][1].setInput( sphere["out"] )
+		group["in"][2].setInput( cube["out"] )
+
+		setA = GafferScene.Set()
+		setA["in"].setInput( group["out"] )
+		setA["name"].setValue( "A" )
+		setA["paths"].setValue( IECore.StringVectorData( [ "/group/plane", "/group/sphere" ] ) )
+
+		setB = GafferScene.Set()
+		setB["in"].setInput( setA["out"] )
+		setB["name"].setValue( "B" )
+		setB["paths"].setValue( IECore.StringVectorData( [ "/group/sphere" ] ) )
+
+		expressionCheck = functools.partial( self.assertCorrectEvaluation, setB["out"] )
+
+		for i in range( 0, 2 ) :
+			expressionCheck( "A - B", [ "/group/plane" ] )
+			expressionCheck( "( A - B ) | /group/cube", [ "/group/plane", "/group/cube" ] )
+
+		# Modifying a result must not affect subsequent evaluations.
+
+		result = GafferScene.SetAlgo.evaluateSetExpression( "A - B", setB["out"] )
+		result.addPath( "/group/sphere" )
+		expressionCheck( "A - B", [ "/group/plane" ] )
+
+		# Results must be updated when the sets change.
+
+		setB["paths"].setValue( IECore.StringVectorData( [ "/group/plane" ] ) )
+		expressionCheck( "A - B", [ "/group/sphere" ] )
+		expressionCheck( "( A - B ) | /group/cube", [ "/group/sphere", "/group/cube" ] )
+
+		# And errors must be reported every time.
+
+		for i in range( 0, 2 ) :
+			with self.assertRaisesRegex( RuntimeError, "Syntax error" ) :
+				GafferScene.SetAlgo.evaluateSetExpression( "A - (", setB["out"] )
+			with self.assertRaisesRegex( RuntimeError, "Syntax error" ) :
+				GafferScene.SetAlgo.setExpressionHash( "A - (", setB["out"] )
+
 	def assertCorrectEvaluation( self, scenePlug, expression, expectedContents ) :
 
 		result = set( GafferScene.SetAlgo.evaluateSetExpression( expression, scenePlug ).paths() )
 		self.assertEqual( result, set( expectedContents ) )
 
+	def testEmptyResultsCountTowardsCacheLimit( self ) :
+
+		sphere = GafferScene.Sphere()
+
+		self.addCleanup( GafferScene.SetAlgo.setExpressionResultCacheLimit, GafferScene.SetAlgo.getExpressionResultCacheLimit() )
+		GafferScene.SetAlgo.setExpressionResultCacheLimit( 100 )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( GafferScene.SetAlgo.expressionResultCacheUsage(), 0 )
+
+		# Each of these expressions has a distinct, empty, result.
+		for i in range( 0, 1000 ) :
+			self.assertTrue( GafferScene.SetAlgo.evaluateSetExpression( "/a{0} & /b{0}".format( i ), sphere["out"] ).isEmpty() )
+
+		self.assertGreater( GafferScene.SetAlgo.expressionResultCacheUsage(), 0 )
+		self.assertLessEqual( GafferScene.SetAlgo.expressionResultCacheUsage(), 100 )
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( GafferScene.SetAlgo.expressionResultCacheUsage(), 0 )
+
 if __name__ == "__main__":
 	unittest.main()
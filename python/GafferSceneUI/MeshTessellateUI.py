@@ -172,6 +172,17 @@ Gaffer.Metadata.registerNode(
 
 			"plugValueWidget:type", "GafferUI.PresetsPlugValueWidget",
 		],
+		"maxEdgeLength" : [
+
+			"description",
+			"""
+			Enables adaptive tessellation when greater than zero. Each edge is then only divided as many
+			times as is needed to make the output edges shorter than this length, with `divisions` acting
+			as the maximum. Lengths are measured on the original mesh, in object space. This avoids wasting
+			memory on small or distant faces of large meshes such as terrain, while keeping the output
+			watertight.
+			""",
+		],
 	}
 
 )
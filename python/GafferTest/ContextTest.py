@@ -809,10 +809,24 @@ class ContextTest( GafferTest.TestCase ) :
 
 		GafferTest.testContextCopyPerformance( 10, 10 )
 
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testContextSetPerformance( self ) :
+
+		GafferTest.testContextSetPerformance()
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testCancellableContextCopyPerformance( self ) :
+
+		GafferTest.testCancellableContextCopyPerformance( 10 )
+
 	def testCopyEditableScope( self ) :
 
 		GafferTest.testCopyEditableScope()
 
+	def testInlineValueReferences( self ) :
+
+		GafferTest.testInlineValueReferences()
+
 	def testSubstituteInternedString( self ) :
 
 		c = Gaffer.Context()
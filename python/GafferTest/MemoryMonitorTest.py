@@ -0,0 +1,167 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+
+import unittest
+
+import Gaffer
+import GafferTest
+
+class MemoryMonitorTest( GafferTest.TestCase ) :
+
+	def test( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearHashCache( now = True )
+
+		n1 = GafferTest.AddNode()
+		n1["op1"].setValue( 20241 )
+		n2 = GafferTest.AddNode()
+		n2["op1"].setValue( 20242 )
+
+		with Gaffer.MemoryMonitor() as m :
+			n1["sum"].getValue()
+
+		s = m.plugStatistics( n1["sum"] )
+		self.assertEqual( s.computeCount, 1 )
+		self.assertGreater( s.computeMemory, 0 )
+		self.assertEqual( s.peakComputeMemory, s.computeMemory )
+		self.assertEqual( s.computeCacheMemory, s.computeMemory )
+		self.assertEqual( s.hashCacheEntries, 1 )
+
+		self.assertNotIn( n2["sum"], m.allStatistics() )
+		self.assertEqual( m.combinedStatistics(), s )
+
+		with m :
+			n2["sum"].getValue()
+
+		s2 = m.plugStatistics( n2["sum"] )
+		self.assertEqual( s2.computeCount, 1 )
+		self.assertEqual( m.combinedStatistics().computeCount, 2 )
+		self.assertEqual( m.combinedStatistics().computeCacheMemory, s.computeCacheMemory + s2.computeCacheMemory )
+		self.assertEqual( m.combinedStatistics().hashCacheEntries, 2 )
+
+		# Dirtying a plug invalidates its hash cache entries, but
+		# doesn't affect the compute cache, which is keyed by hash.
+
+		n1["op2"].setValue( 1 )
+		s = m.plugStatistics( n1["sum"] )
+		self.assertEqual( s.hashCacheEntries, 0 )
+		self.assertEqual( s.computeCacheMemory, s.computeMemory )
+
+		# Clearing the compute cache removes residency, but
+		# not the record of the memory used by computes.
+
+		Gaffer.ValuePlug.clearCache()
+		s = m.plugStatistics( n1["sum"] )
+		self.assertEqual( s.computeCount, 1 )
+		self.assertGreater( s.computeMemory, 0 )
+		self.assertEqual( s.computeCacheMemory, 0 )
+
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		self.assertEqual( m.combinedStatistics().computeCacheMemory, 0 )
+		self.assertEqual( m.combinedStatistics().hashCacheEntries, 0 )
+
+	def testRepeatedComputes( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+
+		n = GafferTest.AddNode()
+		n["op1"].setValue( 20243 )
+
+		with Gaffer.MemoryMonitor() as m :
+			n["sum"].getValue()
+			# Recompute the same value after clearing the cache.
+			Gaffer.ValuePlug.clearCache()
+			n["sum"].getValue()
+
+		s = m.plugStatistics( n["sum"] )
+		self.assertEqual( s.computeCount, 2 )
+		self.assertEqual( s.computeMemory, 2 * s.peakComputeMemory )
+		self.assertEqual( s.computeCacheMemory, s.peakComputeMemory )
+
+	def testFailedComputes( self ) :
+
+		n = GafferTest.BadNode()
+
+		with Gaffer.MemoryMonitor() as m :
+			with self.assertRaises( Exception ) :
+				n["out1"].getValue()
+
+		self.assertEqual( m.plugStatistics( n["out1"] ).computeCount, 0 )
+		self.assertEqual( m.plugStatistics( n["out1"] ).computeCacheMemory, 0 )
+
+	def testQueryDuringBackgroundComputes( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.MultiplyNode()
+		s["n"]["op2"].setValue( 1 )
+		s["e"] = Gaffer.Expression()
+		s["e"].setExpression( """parent["n"]["op1"] = context["op1"]""" )
+
+		def backgroundFunction() :
+
+			GafferTest.parallelGetValue( s["n"]["product"], 10000, "op1" )
+
+		with Gaffer.MemoryMonitor() as m :
+			t = Gaffer.ParallelAlgo.callOnBackgroundThread(
+				s["n"]["product"], backgroundFunction
+			)
+
+		# Querying must be safe while the monitored computes are
+		# still running on other threads.
+		while t.status() in ( t.Status.Pending, t.Status.Running ) :
+			m.combinedStatistics()
+
+		t.wait()
+		self.assertEqual( m.plugStatistics( s["n"]["product"] ).computeCount, 10000 )
+
+	def testStatisticsConstructor( self ) :
+
+		s = Gaffer.MemoryMonitor.Statistics( 1, 2, 3, 4, 5 )
+		self.assertEqual( s.computeCount, 1 )
+		self.assertEqual( s.computeMemory, 2 )
+		self.assertEqual( s.peakComputeMemory, 3 )
+		self.assertEqual( s.computeCacheMemory, 4 )
+		self.assertEqual( s.hashCacheEntries, 5 )
+
+		self.assertEqual( s, eval( repr( s ) ) )
+		self.assertNotEqual( s, Gaffer.MemoryMonitor.Statistics() )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -98,5 +98,71 @@ class MonitorAlgoTest( GafferTest.TestCase ) :
 				[]
 			)
 
+	def testAnnotateMemory( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+
+		s = Gaffer.ScriptNode()
+		s["b"] = Gaffer.Box()
+
+		s["b"]["n1"] = GafferTest.AddNode()
+		s["b"]["n1"]["op1"].setValue( 20244 )
+
+		s["b"]["n2"] = GafferTest.AddNode()
+		s["b"]["n2"]["op1"].setValue( 20245 )
+
+		with Gaffer.MemoryMonitor() as m :
+			s["b"]["n1"]["sum"].getValue()
+			s["b"]["n2"]["sum"].getValue()
+
+		Gaffer.MonitorAlgo.annotate( s, m, Gaffer.MonitorAlgo.MemoryMetric.ComputeCacheMemory )
+
+		n1Memory = m.plugStatistics( s["b"]["n1"]["sum"] ).computeCacheMemory
+		n2Memory = m.plugStatistics( s["b"]["n2"]["sum"] ).computeCacheMemory
+		self.assertGreater( n1Memory, 0 )
+		self.assertLess( n1Memory + n2Memory, 1024 )
+
+		self.assertEqual(
+			Gaffer.MetadataAlgo.getAnnotation( s["b"]["n1"], "memoryMonitor:computeCacheMemory" ).text(),
+			"Compute cache : {} B".format( n1Memory )
+		)
+		self.assertEqual(
+			Gaffer.MetadataAlgo.getAnnotation( s["b"]["n2"], "memoryMonitor:computeCacheMemory" ).text(),
+			"Compute cache : {} B".format( n2Memory )
+		)
+		self.assertEqual(
+			Gaffer.MetadataAlgo.getAnnotation( s["b"], "memoryMonitor:computeCacheMemory" ).text(),
+			"Compute cache : {} B".format( n1Memory + n2Memory )
+		)
+
+		Gaffer.MonitorAlgo.annotate( s, m )
+		self.assertEqual(
+			Gaffer.MetadataAlgo.getAnnotation( s["b"], "memoryMonitor:hashCacheEntries" ).text(),
+			"Hash cache entries : 2"
+		)
+
+		Gaffer.MonitorAlgo.removeMemoryAnnotations( s )
+		for node in Gaffer.Node.RecursiveRange( s ) :
+			self.assertEqual(
+				Gaffer.Metadata.registeredValues( node, Gaffer.Metadata.RegistrationTypes.Instance ),
+				[]
+			)
+
+	def testFormatMemoryStatistics( self ) :
+
+		Gaffer.ValuePlug.clearCache()
+
+		s = Gaffer.ScriptNode()
+		s["n"] = GafferTest.AddNode()
+		s["n"]["op1"].setValue( 20246 )
+
+		with Gaffer.MemoryMonitor() as m :
+			s["n"]["sum"].getValue()
+
+		text = Gaffer.MonitorAlgo.formatStatistics( m )
+		self.assertIn( "MemoryMonitor Summary", text )
+		self.assertIn( "Top 1 plugs by memory resident in the compute cache", text )
+		self.assertIn( "n.sum", text )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -94,6 +94,35 @@ class PerformanceMonitorTest( GafferTest.TestCase ) :
 			m.plugStatistics( a["sum"] ),
 		)
 
+	def testSampling( self ) :
+
+		self.assertEqual( Gaffer.PerformanceMonitor().sampleInterval(), 1 )
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "frame" )
+
+		monitor = Gaffer.PerformanceMonitor( sampleInterval = 10 )
+		self.assertEqual( monitor.sampleInterval(), 10 )
+
+		with monitor :
+			with Gaffer.Context() as context :
+				for i in range( 0, 2000 ) :
+					context.setFrame( i )
+					random["outFloat"].getValue()
+
+		# Statistics are scaled to estimate the true values,
+		# so should be in the right ballpark.
+
+		statistics = monitor.plugStatistics( random["outFloat"] )
+		self.assertEqual( statistics.hashCount % 10, 0 )
+		self.assertEqual( statistics.computeCount % 10, 0 )
+		self.assertGreater( statistics.hashCount, 1400 )
+		self.assertLess( statistics.hashCount, 2600 )
+		self.assertGreater( statistics.computeCount, 1400 )
+		self.assertLess( statistics.computeCount, 2600 )
+		self.assertGreater( statistics.computeDuration, 0 )
+		self.assertEqual( monitor.combinedStatistics(), statistics )
+
 	def testStatisticsConstructorAndAccessors( self ) :
 
 		s = Gaffer.PerformanceMonitor.Statistics(
@@ -70,5 +70,19 @@ class StatsApplicationTest( GafferTest.TestCase ) :
 		self.assertTrue( re.search( r"Box\s*1", o ) )
 		self.assertTrue( re.search( r"Total\s*3", o ) )
 
+	def testMemoryMonitor( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["n"] = GafferTest.AddNode()
+		script["fileName"].setValue( self.temporaryDirectory() / "script.gfr" )
+		script.save()
+
+		o = subprocess.check_output(
+			[ str( Gaffer.executablePath() ), "stats", script["fileName"].getValue(), "-serialise", "-memoryMonitor" ],
+			universal_newlines = True
+		)
+
+		self.assertIn( "MemoryMonitor Summary", o )
+
 if __name__ == "__main__":
 	unittest.main()
@@ -0,0 +1,129 @@
+##########################################################################
+#
+#  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are
+#  met:
+#
+#      * Redistributions of source code must retain the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer.
+#
+#      * Redistributions in binary form must reproduce the above
+#        copyright notice, this list of conditions and the following
+#        disclaimer in the documentation and/or other materials provided with
+#        the distribution.
+#
+#      * Neither the name of John Haddon nor the names of
+#        any other contributors to this software may be used to endorse or
+#        promote products derived from this software without specific prior
+#        written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+#  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+#  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+#  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+#  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+#  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+#  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+#  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+#  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+#  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+#  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+##########################################################################
+
+import json
+import unittest
+
+import IECore
+
+import Gaffer
+import GafferTest
+
+class TraceMonitorTest( GafferTest.TestCase ) :
+
+	def testConstruction( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		self.assertEqual( monitor.events(), [] )
+
+	def testEvents( self ) :
+
+		add1 = GafferTest.AddNode()
+		add2 = GafferTest.AddNode()
+		add2["op1"].setInput( add1["sum"] )
+
+		with Gaffer.TraceMonitor() as monitor :
+			add2["sum"].getValue()
+
+		events = monitor.events()
+		self.assertEqual(
+			[ ( e.type, e.plug ) for e in events ],
+			[
+				( "computeNode:hash", add2["sum"] ),
+				( "computeNode:hash", add1["sum"] ),
+				( "computeNode:compute", add2["sum"] ),
+				( "computeNode:compute", add1["sum"] ),
+			]
+		)
+
+		for event in events :
+			self.assertEqual( event.threadId, Gaffer.ThreadMonitor.thisThreadId() )
+			self.assertEqual( event.contextHash, Gaffer.Context().hash() )
+			self.assertLessEqual( event.start, event.finish )
+
+		# Upstream processes are nested inside downstream ones.
+
+		self.assertEqual( events[0].parentId, 0 )
+		self.assertEqual( events[1].parentId, events[0].processId )
+		self.assertEqual( events[2].parentId, 0 )
+		self.assertEqual( events[3].parentId, events[2].processId )
+		self.assertGreaterEqual( events[1].start, events[0].start )
+		self.assertLessEqual( events[1].finish, events[0].finish )
+
+	def testProcessMask( self ) :
+
+		add = GafferTest.AddNode()
+
+		with Gaffer.TraceMonitor( processMask = [ "computeNode:compute" ] ) as monitor :
+			add["sum"].getValue()
+
+		self.assertEqual( [ e.type for e in monitor.events() ], [ "computeNode:compute" ] )
+
+	def testChromeTrace( self ) :
+
+		random = Gaffer.Random()
+		random["seedVariable"].setValue( "test" )
+
+		with Gaffer.TraceMonitor() as monitor :
+			GafferTest.parallelGetValue( random["outFloat"], 1000, "test" )
+
+		fileName = self.temporaryDirectory() / "trace.json"
+		monitor.writeChromeTrace( str( fileName ) )
+
+		with open( fileName ) as f :
+			trace = json.load( f )
+
+		events = [ e for e in trace["traceEvents"] if e["ph"] == "X" ]
+		self.assertEqual( len( events ), len( monitor.events() ) )
+		self.assertEqual( len( [ e for e in events if e["cat"] == "computeNode:compute" ] ), 1000 )
+		for event in events :
+			self.assertEqual( event["name"], random["outFloat"].fullName() )
+			self.assertGreaterEqual( event["dur"], 0 )
+
+		threadNames = [ e for e in trace["traceEvents"] if e["ph"] == "M" ]
+		self.assertEqual(
+			{ e["tid"] for e in threadNames },
+			{ e["tid"] for e in events }
+		)
+
+	def testWriteToInvalidFile( self ) :
+
+		monitor = Gaffer.TraceMonitor()
+		with self.assertRaises( RuntimeError ) :
+			monitor.writeChromeTrace( str( self.temporaryDirectory() / "missingDirectory" / "trace.json" ) )
+
+if __name__ == "__main__":
+	unittest.main()
@@ -791,6 +791,275 @@ class ValuePlugTest( GafferTest.TestCase ) :
 			node["sum"].getValue()
 		self.assertEqual( m.plugStatistics( node["sum"] ).hashCount, 1 )
 
+	def testHashCachePersistsForUnaffectedPlugs( self ) :
+
+		script = Gaffer.ScriptNode()
+		script["add1"] = GafferTest.AddNode()
+		script["add2"] = GafferTest.AddNode()
+		script["add3"] = GafferTest.AddNode()
+		script["add3"]["op1"].setInput( script["add1"]["sum"] )
+		script["add3"]["op2"].setInput( script["add2"]["sum"] )
+
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		script["add3"]["sum"].getValue()
+		usage = Gaffer.ValuePlug.hashCacheTotalUsage()
+
+		for i in range( 0, 10 ) :
+
+			script["add1"]["op1"].setValue( i )
+			with Gaffer.PerformanceMonitor() as m :
+				self.assertEqual( script["add3"]["sum"].getValue(), i )
+
+			# Only the plugs downstream of the edit should be rehashed.
+			self.assertEqual( m.plugStatistics( script["add1"]["sum"] ).hashCount, 1 )
+			self.assertEqual( m.plugStatistics( script["add3"]["sum"] ).hashCount, 1 )
+			self.assertEqual( m.plugStatistics( script["add2"]["sum"] ).hashCount, 0 )
+
+			# And the entries they replace should have been removed from
+			# the cache, rather than accumulating until they are evicted.
+			self.assertEqual( Gaffer.ValuePlug.hashCacheTotalUsage(), usage )
+
+	def testDiskCache( self ) :
+
+		Gaffer.ValuePlug.setDiskCacheDirectory( str( self.temporaryDirectory() / "diskCache" ) )
+		self.assertEqual( Gaffer.ValuePlug.getDiskCacheDirectory(), str( self.temporaryDirectory() / "diskCache" ) )
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		node = GafferTest.CachingTestNode()
+		node["in"].setValue( "x" * 10000 )
+		value = node["out"].getValue()
+
+		# Clearing the cache discards values rather than
+		# writing them to disk.
+
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		# But eviction writes them to disk.
+
+		node["out"].getValue()
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		self.assertGreater( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		# From where they can be reloaded without computing.
+
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( node["out"].getValue(), value )
+		self.assertEqual( m.plugStatistics( node["out"] ).computeCount, 0 )
+
+		# Unless we've cleared the disk cache.
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.clearDiskCache()
+		self.assertEqual( Gaffer.ValuePlug.diskCacheUsage(), 0 )
+
+		with Gaffer.PerformanceMonitor() as m :
+			self.assertEqual( node["out"].getValue(), value )
+		self.assertEqual( m.plugStatistics( node["out"] ).computeCount, 1 )
+
+	def testCachePartitions( self ) :
+
+		class PartitionedNode( GafferTest.CachingTestNode ) :
+
+			def computeCachePartition( self, output ) :
+
+				return "ValuePlugTest.testCachePartitions"
+
+		self.assertIn( "", Gaffer.ValuePlug.cachePartitions() )
+		self.assertNotIn( "ValuePlugTest.testCachePartitions", Gaffer.ValuePlug.cachePartitions() )
+
+		Gaffer.ValuePlug.setCachePartitionMemoryLimit( "ValuePlugTest.testCachePartitions", 1024 ** 2 )
+		self.assertIn( "ValuePlugTest.testCachePartitions", Gaffer.ValuePlug.cachePartitions() )
+		self.assertEqual( Gaffer.ValuePlug.getCachePartitionMemoryLimit( "ValuePlugTest.testCachePartitions" ), 1024 ** 2 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( "ValuePlugTest.testCachePartitions" ), 0 )
+
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.resetCacheStatistics()
+
+		node = PartitionedNode()
+		node["in"].setValue( "test" )
+
+		node["out"].getValue()
+		statistics = Gaffer.ValuePlug.cachePartitionStatistics( "ValuePlugTest.testCachePartitions" )
+		self.assertEqual( statistics.hits, 0 )
+		self.assertEqual( statistics.misses, 1 )
+		self.assertEqual( statistics.evictions, 0 )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "ValuePlugTest.testCachePartitions" ), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+
+		node["out"].getValue()
+		statistics = Gaffer.ValuePlug.cachePartitionStatistics( "ValuePlugTest.testCachePartitions" )
+		self.assertEqual( statistics.hits, 1 )
+		self.assertEqual( statistics.misses, 1 )
+
+		# Evicting from the default partition doesn't affect ours.
+
+		Gaffer.ValuePlug.setCacheMemoryLimit( 0 )
+		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "ValuePlugTest.testCachePartitions" ), 0 )
+
+		# But reducing our own limit does.
+
+		Gaffer.ValuePlug.setCachePartitionMemoryLimit( "ValuePlugTest.testCachePartitions", 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( "ValuePlugTest.testCachePartitions" ), 0 )
+		statistics = Gaffer.ValuePlug.cachePartitionStatistics( "ValuePlugTest.testCachePartitions" )
+		self.assertEqual( statistics.evictions, 1 )
+		self.assertGreater( statistics.evictedCost, 0 )
+
+		# Global statistics include all partitions.
+
+		self.assertGreaterEqual( Gaffer.ValuePlug.cacheStatistics().hits, 1 )
+		self.assertGreaterEqual( Gaffer.ValuePlug.cacheStatistics().evictions, 1 )
+
+		Gaffer.ValuePlug.resetCacheStatistics()
+		statistics = Gaffer.ValuePlug.cachePartitionStatistics( "ValuePlugTest.testCachePartitions" )
+		self.assertEqual( statistics.hits, 0 )
+		self.assertEqual( statistics.misses, 0 )
+		self.assertEqual( statistics.evictions, 0 )
+		self.assertEqual( statistics.evictedCost, 0 )
+
+	def testCachePartitionAdoptsExistingValues( self ) :
+
+		class PartitionedNode( GafferTest.CachingTestNode ) :
+
+			def __init__( self, name = "PartitionedNode" ) :
+
+				GafferTest.CachingTestNode.__init__( self, name )
+				self.numComputeCalls = 0
+
+			def computeCachePartition( self, output ) :
+
+				return "ValuePlugTest.testCachePartitionAdoptsExistingValues"
+
+			def compute( self, plug, context ) :
+
+				self.numComputeCalls += 1
+				GafferTest.CachingTestNode.compute( self, plug, context )
+
+		Gaffer.ValuePlug.clearCache()
+
+		node = PartitionedNode()
+		node["in"].setValue( "test" )
+
+		# No limit has been set for the partition yet, so the value is
+		# stored in the default partition.
+
+		node["out"].getValue()
+		self.assertEqual( node.numComputeCalls, 1 )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+
+		# Once the partition exists, the value is moved into it rather
+		# than being recomputed.
+
+		Gaffer.ValuePlug.setCachePartitionMemoryLimit( "ValuePlugTest.testCachePartitionAdoptsExistingValues", 1024 ** 2 )
+		node["out"].getValue()
+		self.assertEqual( node.numComputeCalls, 1 )
+		self.assertGreater( Gaffer.ValuePlug.cachePartitionMemoryUsage( "ValuePlugTest.testCachePartitionAdoptsExistingValues" ), 0 )
+		self.assertEqual( Gaffer.ValuePlug.cachePartitionMemoryUsage( "" ), 0 )
+
+	class __EvictionTestNode( GafferTest.CachingTestNode ) :
+
+		def __init__( self, name = "EvictionTestNode" ) :
+
+			GafferTest.CachingTestNode.__init__( self, name )
+			self.numComputeCalls = 0
+
+		def compute( self, plug, context ) :
+
+			self.numComputeCalls += 1
+			value = self["in"].getValue()
+			if value.startswith( "slow" ) :
+				time.sleep( 0.05 )
+
+			self["out"].setValue( IECore.StringData( value ) )
+
+	def testCacheEvictionMode( self ) :
+
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionMode(), Gaffer.ValuePlug.CacheEvictionMode.LRU )
+
+		node = self.__EvictionTestNode()
+
+		def expensiveValueSurvives() :
+
+			Gaffer.ValuePlug.clearCache()
+			Gaffer.ValuePlug.setCacheMemoryLimit( 1024 ** 2 )
+
+			node["in"].setValue( "slow" )
+			node["out"].getValue()
+
+			# Fill the cache several times over with large values
+			# that are cheap to compute.
+			for i in range( 0, 30 ) :
+				node["in"].setValue( "x" * 100000 + str( i ) )
+				node["out"].getValue()
+
+			node["in"].setValue( "slow" )
+			numComputeCalls = node.numComputeCalls
+			node["out"].getValue()
+			return node.numComputeCalls == numComputeCalls
+
+		Gaffer.ValuePlug.resetCacheStatistics()
+		self.assertFalse( expensiveValueSurvives() )
+		# Computes are only timed when CostAware eviction needs them to be.
+		self.assertEqual( Gaffer.ValuePlug.cacheStatistics().computeDuration, 0 )
+
+		Gaffer.ValuePlug.setCacheEvictionMode( Gaffer.ValuePlug.CacheEvictionMode.CostAware )
+		self.assertEqual( Gaffer.ValuePlug.getCacheEvictionMode(), Gaffer.ValuePlug.CacheEvictionMode.CostAware )
+		self.assertTrue( expensiveValueSurvives() )
+		self.assertGreaterEqual( Gaffer.ValuePlug.cacheStatistics().computeDuration, 50 * 1000 * 1000 )
+
+	def __evictionModePerformance( self, mode ) :
+
+		Gaffer.ValuePlug.setCacheEvictionMode( mode )
+		Gaffer.ValuePlug.clearCache()
+		Gaffer.ValuePlug.setCacheMemoryLimit( 4 * 1024 ** 2 )
+
+		node = self.__EvictionTestNode()
+
+		# A working set containing a few values that are slow
+		# to compute, and many that are cheap to compute but large
+		# enough to overflow the cache.
+		with GafferTest.TestRunner.PerformanceScope() :
+			for i in range( 0, 20 ) :
+				for j in range( 0, 5 ) :
+					node["in"].setValue( "slow{}".format( j ) )
+					node["out"].getValue()
+				for j in range( 0, 100 ) :
+					node["in"].setValue( "x" * 100000 + str( j ) )
+					node["out"].getValue()
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testLRUEvictionPerformance( self ) :
+
+		self.__evictionModePerformance( Gaffer.ValuePlug.CacheEvictionMode.LRU )
+
+	@GafferTest.TestRunner.PerformanceTestMethod()
+	def testCostAwareEvictionPerformance( self ) :
+
+		self.__evictionModePerformance( Gaffer.ValuePlug.CacheEvictionMode.CostAware )
+
+	def testHashCacheStatistics( self ) :
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+
+		Gaffer.ValuePlug.clearHashCache( now = True )
+		Gaffer.ValuePlug.resetHashCacheStatistics()
+
+		node["sum"].hash()
+		statistics = Gaffer.ValuePlug.hashCacheStatistics()
+		self.assertEqual( statistics.hits, 0 )
+		self.assertGreater( statistics.misses, 0 )
+
+		node["sum"].hash()
+		self.assertGreater( Gaffer.ValuePlug.hashCacheStatistics().hits, 0 )
+
+		Gaffer.ValuePlug.resetHashCacheStatistics()
+		statistics = Gaffer.ValuePlug.hashCacheStatistics()
+		self.assertEqual( statistics.hits, 0 )
+		self.assertEqual( statistics.misses, 0 )
+
 	def testResetDefault( self ) :
 
 		script = Gaffer.ScriptNode()
@@ -1067,17 +1336,55 @@ class ValuePlugTest( GafferTest.TestCase ) :
 					node["in"].setValue( i )
 					self.assertEqual( node["out"].getValue(), i )
 
+	def testRemoveCachedValue( self ) :
+
+		node = GafferTest.AddNode()
+		node["op1"].setValue( 1 )
+
+		self.assertEqual( node["sum"].getValue(), 1 )
+		self.assertEqual( node.numComputeCalls, 1 )
+		self.assertEqual( node["sum"].getValue(), 1 )
+		self.assertEqual( node.numComputeCalls, 1 )
+
+		# Removing the value should force it to be recomputed.
+
+		node["sum"].removeCachedValue()
+		self.assertEqual( node["sum"].getValue(), 1 )
+		self.assertEqual( node.numComputeCalls, 2 )
+
+		# Removing a value that isn't cached is harmless.
+
+		node["sum"].removeCachedValue()
+		node["sum"].removeCachedValue()
+		self.assertEqual( node["sum"].getValue(), 1 )
+		self.assertEqual( node.numComputeCalls, 3 )
+
+		# As is calling it on a plug whose value is stored on the plug itself.
+
+		node["op1"].removeCachedValue()
+		self.assertEqual( node["op1"].getValue(), 1 )
+
+	def testCacheClearedSignal( self ) :
+
+		cs = GafferTest.CapturingSlot( Gaffer.ValuePlug.cacheClearedSignal() )
+		Gaffer.ValuePlug.clearCache()
+		self.assertEqual( len( cs ), 1 )
+
 	def setUp( self ) :
 
 		GafferTest.TestCase.setUp( self )
 
 		self.__originalCacheMemoryLimit = Gaffer.ValuePlug.getCacheMemoryLimit()
+		self.__originalDiskCacheDirectory = Gaffer.ValuePlug.getDiskCacheDirectory()
+		self.__originalCacheEvictionMode = Gaffer.ValuePlug.getCacheEvictionMode()
 
 	def tearDown( self ) :
 
 		GafferTest.TestCase.tearDown( self )
 
 		Gaffer.ValuePlug.setCacheMemoryLimit( self.__originalCacheMemoryLimit )
+		Gaffer.ValuePlug.setDiskCacheDirectory( self.__originalDiskCacheDirectory )
+		Gaffer.ValuePlug.setCacheEvictionMode( self.__originalCacheEvictionMode )
 
 if __name__ == "__main__":
 	unittest.main()
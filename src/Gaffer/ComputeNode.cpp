@@ -91,3 +91,9 @@ ValuePlug::CachePolicy ComputeNode::computeCachePolicy( const ValuePlug *output
 	}
 	return ValuePlug::CachePolicy::Default;
 }
+
+IECore::InternedString ComputeNode::computeCachePartition( const ValuePlug *output ) const
+{
+	static const IECore::InternedString g_defaultPartition;
+	return g_defaultPartition;
+}
@@ -160,6 +160,19 @@ Context::Value Context::Value::copy( IECore::ConstDataPtr &owner ) const
 	return Value( m_typeId, v, m_hash );
 }
 
+bool Context::Value::inlineable( IECore::TypeId typeId )
+{
+	return typeFunctions( typeId ).copyInline;
+}
+
+Context::Value Context::Value::copyInline( void *storage ) const
+{
+	// The hash can be reused as-is, because it doesn't
+	// depend on where the value is stored.
+	typeFunctions( m_typeId ).copyInline( m_value, storage );
+	return Value( m_typeId, storage, m_hash );
+}
+
 void Context::Value::validate( const IECore::InternedString &name ) const
 {
 	typeFunctions( m_typeId ).validate( name, *this );
@@ -229,7 +242,7 @@ static InternedString g_frame( "frame" );
 static InternedString g_framesPerSecond( "framesPerSecond" );
 
 Context::Context()
-	:	m_changedSignal( nullptr ), m_hashValid( false ), m_canceller( nullptr )
+	:	m_changedSignal( nullptr ), m_hashValid( false ), m_canceller( nullptr ), m_freeInlineSlots( nullptr )
 {
 	set( g_frame, 1.0f );
 	set( g_framesPerSecond, 24.0f );
@@ -244,41 +257,54 @@ Context::Context( const Context &other, CopyMode mode )
 	:	m_changedSignal( nullptr ),
 		m_hash( other.m_hash ),
 		m_hashValid( other.m_hashValid ),
-		m_canceller( other.m_canceller )
+		m_canceller( other.m_canceller ),
+		m_freeInlineSlots( nullptr )
 {
 	// Reserving one extra spot before we copy in the existing variables means that we will
 	// avoid a second allocation in the common case where we set exactly one context
 	// variable. Perhaps we should reserve two extra spots - though that is some extra memory
 	// to carry around in cases where we don't add any variables?
 	m_map.reserve( other.m_map.size() + 1 );
+	m_map = other.m_map;
 
-	if( mode == CopyMode::NonOwning )
-	{
-		m_map = other.m_map;
-	}
-	else
+	if( mode == CopyMode::Owning )
 	{
 		// We need ownership of the stored values so that we remain valid even
-		// if the source context is destroyed.
-		m_allocMap.reserve( other.m_map.size() + 1 );
-		for( auto &i : other.m_map )
+		// if the source context is destroyed. Hashes are copied along with
+		// the values, so none of this requires rehashing.
+		m_allocMap.reserve( other.m_allocMap.size() );
+		// Share ownership of `other`'s inline storage. Neither context
+		// writes to a shared block, so this is as cheap as sharing `Data`.
+		m_inlineBlocks = other.m_inlineBlocks;
+		for( auto &[name, value] : m_map )
 		{
-			auto allocIt = other.m_allocMap.find( i.first );
+			if( Value::inlineable( value.typeId() ) )
+			{
+				if( !other.inlineSlot( value ) )
+				{
+					// Value not stored by `other`, for instance because it was
+					// set via an EditableScope. Take a copy that we own.
+					value = value.copyInline( acquireInlineSlot()->storage );
+				}
+				continue;
+			}
+
+			auto allocIt = other.m_allocMap.find( name );
 			if(
 				allocIt != other.m_allocMap.end() &&
-				i.second.references( allocIt->second.get() )
+				value.references( allocIt->second.get() )
 			)
 			{
 				// The value is already owned by `other`, and is immutable, so we
 				// can just share ownership with it.
-				internalSetWithOwner( i.first, i.second, ConstDataPtr( allocIt->second ) );
+				m_allocMap.emplace_hint( m_allocMap.end(), name, allocIt->second );
 			}
 			else
 			{
-				// Data not owned by `other`. Take a copy that we own, and call `internalSet()`.
+				// Data not owned by `other`. Take a copy that we own.
 				ConstDataPtr owner;
-				const Value v = i.second.copy( owner );
-				internalSetWithOwner( i.first, v, std::move( owner ) );
+				value = value.copy( owner );
+				m_allocMap.emplace_hint( m_allocMap.end(), name, std::move( owner ) );
 			}
 		}
 	}
@@ -310,10 +336,18 @@ Context::~Context()
 
 void Context::set( const IECore::InternedString &name, const IECore::Data *value )
 {
+	if( Value::inlineable( value->typeId() ) )
+	{
+		// `v` references `value`, and will be copied into
+		// storage of our own by `internalSetInline()`.
+		const Value v( name, value );
+		internalSetInline( name, v, [&v] ( void *storage ) { return v.copyInline( storage ); } );
+		return;
+	}
+
 	// We copy the value so that the client can't invalidate this context by changing it.
 	ConstDataPtr copy = value->copy();
-	const Value v( name, copy.get() );
-	internalSetWithOwner( name, v, std::move( copy ) );
+	internalSetWithOwner( name, Value( name, copy.get() ), std::move( copy ) );
 }
 
 IECore::DataPtr Context::getAsData( const IECore::InternedString &name ) const
@@ -335,6 +369,7 @@ void Context::remove( const IECore::InternedString &name )
 	Map::iterator it = m_map.find( name );
 	if( it != m_map.end() )
 	{
+		releaseInlineSlot( it->second );
 		m_map.erase( it );
 		m_hashValid = false;
 		if( m_changedSignal )
@@ -355,6 +390,7 @@ void Context::removeMatching( const StringAlgo::MatchPattern &pattern )
 	{
 		if( StringAlgo::matchMultiple( it->first, pattern ) )
 		{
+			releaseInlineSlot( it->second );
 			it = m_map.erase( it );
 			m_hashValid = false;
 			if( m_changedSignal )
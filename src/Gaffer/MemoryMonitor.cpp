@@ -0,0 +1,320 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/MemoryMonitor.h"
+
+#include "Gaffer/Context.h"
+#include "Gaffer/Process.h"
+#include "Gaffer/ValuePlug.h"
+
+#include <algorithm>
+
+using namespace Gaffer;
+
+namespace
+{
+
+const MemoryMonitor::Statistics g_emptyStatistics;
+
+// The minimum number of recently added keys that will trigger
+// a call to `prune()`. Beyond this, we prune whenever the number of
+// recent keys exceeds the number retained by the last prune, so that
+// the cost of pruning is amortised over many processes.
+const size_t g_minPruneKeys = 1024;
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// MemoryMonitor::Statistics
+//////////////////////////////////////////////////////////////////////////
+
+MemoryMonitor::Statistics::Statistics( size_t computeCount, size_t computeMemory, size_t peakComputeMemory, size_t computeCacheMemory, size_t hashCacheEntries )
+	:	computeCount( computeCount ), computeMemory( computeMemory ), peakComputeMemory( peakComputeMemory ),
+		computeCacheMemory( computeCacheMemory ), hashCacheEntries( hashCacheEntries )
+{
+}
+
+MemoryMonitor::Statistics & MemoryMonitor::Statistics::operator += ( const Statistics &rhs )
+{
+	computeCount += rhs.computeCount;
+	computeMemory += rhs.computeMemory;
+	peakComputeMemory = std::max( peakComputeMemory, rhs.peakComputeMemory );
+	computeCacheMemory += rhs.computeCacheMemory;
+	hashCacheEntries += rhs.hashCacheEntries;
+	return *this;
+}
+
+bool MemoryMonitor::Statistics::operator == ( const Statistics &rhs )
+{
+	return
+		computeCount == rhs.computeCount &&
+		computeMemory == rhs.computeMemory &&
+		peakComputeMemory == rhs.peakComputeMemory &&
+		computeCacheMemory == rhs.computeCacheMemory &&
+		hashCacheEntries == rhs.hashCacheEntries
+	;
+}
+
+bool MemoryMonitor::Statistics::operator != ( const Statistics &rhs )
+{
+	return !( *this == rhs );
+}
+
+//////////////////////////////////////////////////////////////////////////
+// MemoryMonitor
+//////////////////////////////////////////////////////////////////////////
+
+MemoryMonitor::MemoryMonitor()
+{
+}
+
+MemoryMonitor::~MemoryMonitor()
+{
+}
+
+const MemoryMonitor::StatisticsMap &MemoryMonitor::allStatistics() const
+{
+	collate();
+	return m_statistics;
+}
+
+const MemoryMonitor::Statistics &MemoryMonitor::plugStatistics( const Plug *plug ) const
+{
+	collate();
+	StatisticsMap::const_iterator it = m_statistics.find( plug );
+	if( it == m_statistics.end() )
+	{
+		return g_emptyStatistics;
+	}
+	return it->second;
+}
+
+const MemoryMonitor::Statistics &MemoryMonitor::combinedStatistics() const
+{
+	collate();
+	return m_combinedStatistics;
+}
+
+void MemoryMonitor::processStarted( const Process *process )
+{
+}
+
+void MemoryMonitor::processFinished( const Process *process )
+{
+	if( process->type() == ValuePlug::computeProcessType() )
+	{
+		const IECore::MurmurHash *cacheKey = nullptr;
+		const IECore::Object *result = ValuePlug::computeResult( process, cacheKey );
+		if( !result )
+		{
+			// Compute failed.
+			return;
+		}
+
+		ThreadData &threadData = m_threadData.local();
+		tbb::spin_mutex::scoped_lock lock( threadData.mutex );
+		PlugData &plugData = threadData.plugData[process->plug()];
+
+		size_t memory;
+		if( cacheKey )
+		{
+			// `memoryUsage()` can be expensive, so avoid calling it
+			// again if we've already seen this result.
+			auto it = plugData.computeCacheKeys.find( *cacheKey );
+			if( it != plugData.computeCacheKeys.end() )
+			{
+				memory = it->second;
+			}
+			else
+			{
+				auto inserted = plugData.recentComputeCacheKeys.insert( { *cacheKey, 0 } );
+				if( inserted.second )
+				{
+					inserted.first->second = result->memoryUsage();
+					threadData.numRecentKeys++;
+				}
+				memory = inserted.first->second;
+			}
+		}
+		else
+		{
+			memory = result->memoryUsage();
+		}
+
+		Statistics &statistics = plugData.statistics;
+		statistics.computeCount++;
+		statistics.computeMemory += memory;
+		statistics.peakComputeMemory = std::max( statistics.peakComputeMemory, memory );
+
+		if( threadData.numRecentKeys > std::max( g_minPruneKeys, threadData.numKeys ) )
+		{
+			prune( threadData, /* checkRecent = */ false );
+		}
+	}
+	else if( process->type() == ValuePlug::hashProcessType() )
+	{
+		const ValuePlug *plug = static_cast<const ValuePlug *>( process->plug() );
+		ThreadData &threadData = m_threadData.local();
+		tbb::spin_mutex::scoped_lock lock( threadData.mutex );
+		PlugData &plugData = threadData.plugData[plug];
+		const PlugData::HashCacheKeys::value_type key( process->context()->hash(), plug->dirtyCount() );
+		if( !plugData.hashCacheKeys.count( key ) && plugData.recentHashCacheKeys.insert( key ).second )
+		{
+			threadData.numRecentKeys++;
+		}
+
+		if( threadData.numRecentKeys > std::max( g_minPruneKeys, threadData.numKeys ) )
+		{
+			prune( threadData, /* checkRecent = */ false );
+		}
+	}
+}
+
+void MemoryMonitor::prune( ThreadData &threadData, bool checkRecent )
+{
+	auto mergeRecent = [] ( PlugData &plugData ) {
+		plugData.computeCacheKeys.insert( plugData.recentComputeCacheKeys.begin(), plugData.recentComputeCacheKeys.end() );
+		plugData.recentComputeCacheKeys.clear();
+		plugData.hashCacheKeys.insert( plugData.recentHashCacheKeys.begin(), plugData.recentHashCacheKeys.end() );
+		plugData.recentHashCacheKeys.clear();
+	};
+
+	threadData.numKeys = 0;
+	for( auto &[plug, plugData] : threadData.plugData )
+	{
+		if( checkRecent )
+		{
+			mergeRecent( plugData );
+		}
+
+		for( auto it = plugData.computeCacheKeys.begin(); it != plugData.computeCacheKeys.end(); )
+		{
+			if( ValuePlug::computeCacheContains( it->first ) )
+			{
+				++it;
+			}
+			else
+			{
+				it = plugData.computeCacheKeys.erase( it );
+			}
+		}
+
+		const ValuePlug *valuePlug = static_cast<const ValuePlug *>( plug.get() );
+		for( auto it = plugData.hashCacheKeys.begin(); it != plugData.hashCacheKeys.end(); )
+		{
+			if( ValuePlug::hashCacheContains( valuePlug, it->first, it->second ) )
+			{
+				++it;
+			}
+			else
+			{
+				it = plugData.hashCacheKeys.erase( it );
+			}
+		}
+
+		// Otherwise, recent keys will be checked next time.
+		mergeRecent( plugData );
+
+		threadData.numKeys += plugData.computeCacheKeys.size() + plugData.hashCacheKeys.size();
+	}
+	threadData.numRecentKeys = 0;
+}
+
+void MemoryMonitor::collate() const
+{
+	ThreadData &localThreadData = m_threadData.local();
+
+	// Compute cache residency can be determined from any thread, but
+	// a result may have been recorded by several threads, so we gather
+	// the resident keys for each plug before summing their memory.
+	boost::unordered_map<ConstPlugPtr, PlugData::ComputeCacheKeys> residentComputeCacheKeys;
+
+	m_statistics.clear();
+	for( auto &threadData : m_threadData )
+	{
+		tbb::spin_mutex::scoped_lock lock( threadData.mutex );
+		if( &threadData == &localThreadData )
+		{
+			// We can only check residency for the hash cache
+			// belonging to this thread. No processes are running
+			// on this thread, so recent keys can be checked too.
+			prune( threadData, /* checkRecent = */ true );
+		}
+
+		for( const auto &[plug, plugData] : threadData.plugData )
+		{
+			Statistics &statistics = m_statistics[plug];
+			statistics += plugData.statistics;
+
+			PlugData::ComputeCacheKeys &resident = residentComputeCacheKeys[plug];
+			for( const auto *keys : { &plugData.computeCacheKeys, &plugData.recentComputeCacheKeys } )
+			{
+				for( const auto &[key, memory] : *keys )
+				{
+					if( ValuePlug::computeCacheContains( key ) )
+					{
+						resident[key] = memory;
+					}
+				}
+			}
+
+			// Hash cache entries for a previous dirty count can never
+			// be used again, so we don't need to check for residency
+			// to know that they have been invalidated.
+			const uint64_t dirtyCount = static_cast<const ValuePlug *>( plug.get() )->dirtyCount();
+			for( const auto *keys : { &plugData.hashCacheKeys, &plugData.recentHashCacheKeys } )
+			{
+				for( const auto &key : *keys )
+				{
+					if( key.second == dirtyCount )
+					{
+						statistics.hashCacheEntries++;
+					}
+				}
+			}
+		}
+	}
+
+	m_combinedStatistics = Statistics();
+	for( auto &[plug, statistics] : m_statistics )
+	{
+		for( const auto &[key, memory] : residentComputeCacheKeys[plug] )
+		{
+			statistics.computeCacheMemory += memory;
+		}
+		m_combinedStatistics += statistics;
+	}
+}
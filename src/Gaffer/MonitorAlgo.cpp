@@ -37,6 +37,7 @@
 #include "Gaffer/MonitorAlgo.h"
 
 #include "Gaffer/ContextMonitor.h"
+#include "Gaffer/MemoryMonitor.h"
 #include "Gaffer/MetadataAlgo.h"
 #include "Gaffer/Node.h"
 #include "Gaffer/PerformanceMonitor.h"
@@ -231,6 +232,138 @@ std::invoke_result_t<F, const HashCountMetric &> dispatchMetric( const F &f, Mon
 	}
 }
 
+// Memory sizes, formatted in human readable units.
+struct MemorySize
+{
+
+	explicit MemorySize( size_t bytes = 0 )
+		:	bytes( bytes )
+	{
+	}
+
+	bool operator == ( const MemorySize &rhs ) const { return bytes == rhs.bytes; }
+	bool operator < ( const MemorySize &rhs ) const { return bytes < rhs.bytes; }
+	bool operator > ( const MemorySize &rhs ) const { return bytes > rhs.bytes; }
+
+	size_t bytes;
+
+};
+
+std::ostream &operator << ( std::ostream &os, const MemorySize &memorySize )
+{
+	static const char *g_units[] = { "B", "KB", "MB", "GB", "TB" };
+
+	double value = memorySize.bytes;
+	size_t unit = 0;
+	while( value >= 1024.0 && unit < 4 )
+	{
+		value /= 1024.0;
+		unit++;
+	}
+
+	std::ostringstream s;
+	s << std::fixed << std::setprecision( unit ? 2 : 0 ) << value << " " << g_units[unit];
+	return os << s.str();
+}
+
+struct InvalidMemoryMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const MemoryMonitor::Statistics &s ) const
+	{
+		return 0;
+	}
+
+	const std::string description = "invalid";
+	const std::string annotation = "invalid";
+	const std::string annotationPrefix = "invalid";
+
+};
+
+struct ComputeCacheMemoryMetric
+{
+
+	using ResultType = MemorySize;
+
+	ResultType operator() ( const MemoryMonitor::Statistics &s ) const
+	{
+		return MemorySize( s.computeCacheMemory );
+	}
+
+	const std::string description = "memory resident in the compute cache";
+	const std::string annotation = "memoryMonitor:computeCacheMemory";
+	const std::string annotationPrefix = "Compute cache : ";
+
+};
+
+struct HashCacheEntriesMetric
+{
+
+	using ResultType = size_t;
+
+	ResultType operator() ( const MemoryMonitor::Statistics &s ) const
+	{
+		return s.hashCacheEntries;
+	}
+
+	const std::string description = "entries resident in the hash cache";
+	const std::string annotation = "memoryMonitor:hashCacheEntries";
+	const std::string annotationPrefix = "Hash cache entries : ";
+
+};
+
+struct ComputeMemoryMetric
+{
+
+	using ResultType = MemorySize;
+
+	ResultType operator() ( const MemoryMonitor::Statistics &s ) const
+	{
+		return MemorySize( s.computeMemory );
+	}
+
+	const std::string description = "memory used by compute results";
+	const std::string annotation = "memoryMonitor:computeMemory";
+	const std::string annotationPrefix = "Compute memory : ";
+
+};
+
+struct PeakComputeMemoryMetric
+{
+
+	using ResultType = MemorySize;
+
+	ResultType operator() ( const MemoryMonitor::Statistics &s ) const
+	{
+		return MemorySize( s.peakComputeMemory );
+	}
+
+	const std::string description = "memory used by a single compute result";
+	const std::string annotation = "memoryMonitor:peakComputeMemory";
+	const std::string annotationPrefix = "Peak compute memory : ";
+
+};
+
+template<typename F>
+std::invoke_result_t<F, const ComputeCacheMemoryMetric &> dispatchMetric( const F &f, MonitorAlgo::MemoryMetric memoryMetric )
+{
+	switch( memoryMetric )
+	{
+		case MonitorAlgo::MemoryMetric::ComputeCacheMemory :
+			return f( ComputeCacheMemoryMetric() );
+		case MonitorAlgo::MemoryMetric::HashCacheEntries :
+			return f( HashCacheEntriesMetric() );
+		case MonitorAlgo::MemoryMetric::ComputeMemory :
+			return f( ComputeMemoryMetric() );
+		case MonitorAlgo::MemoryMetric::PeakComputeMemory :
+			return f( PeakComputeMemoryMetric() );
+		default :
+			return f( InvalidMemoryMetric() );
+	}
+}
+
 const std::string g_contextAnnotationName = "contextMonitor";
 
 struct AnnotationRegistrations
@@ -254,6 +387,20 @@ struct AnnotationRegistrations
 			);
 		}
 
+		for( int m = (int)Gaffer::MonitorAlgo::MemoryMetric::First; m <= (int)Gaffer::MonitorAlgo::MemoryMetric::Last; ++m )
+		{
+			dispatchMetric(
+				[] ( auto metric ) {
+					MetadataAlgo::addAnnotationTemplate(
+						metric.annotation,
+						MetadataAlgo::Annotation( "" ),
+						/* user = */ false
+					);
+				},
+				static_cast<Gaffer::MonitorAlgo::MemoryMetric>( m )
+			);
+		}
+
 		MetadataAlgo::addAnnotationTemplate(
 			g_contextAnnotationName,
 			MetadataAlgo::Annotation( "" ),
@@ -273,16 +420,18 @@ const AnnotationRegistrations g_annotationRegistrations;
 namespace
 {
 
+template<typename Statistics>
 struct PlugAndStatistics
 {
 
-	PlugAndStatistics( const PerformanceMonitor::StatisticsMap::value_type &v )
+	template<typename Value>
+	PlugAndStatistics( const Value &v )
 		:	plug( v.first.get() ), statistics( v.second )
 	{
 	}
 
 	const Plug *plug;
-	PerformanceMonitor::Statistics statistics;
+	Statistics statistics;
 
 };
 
@@ -290,7 +439,8 @@ template<typename Metric>
 struct MetricGreater
 {
 
-	bool operator() ( const PlugAndStatistics &lhs, const PlugAndStatistics &rhs ) const
+	template<typename Statistics>
+	bool operator() ( const PlugAndStatistics<Statistics> &lhs, const PlugAndStatistics<Statistics> &rhs ) const
 	{
 		return metric( lhs.statistics ) > metric( rhs.statistics );
 	}
@@ -315,10 +465,11 @@ void outputItems( const std::vector<std::string> &names, const std::vector<Item>
 	}
 }
 
+template<typename StatisticsMap>
 struct FormatStatistics
 {
 
-	FormatStatistics( const PerformanceMonitor::StatisticsMap &statistics, size_t maxLines )
+	FormatStatistics( const StatisticsMap &statistics, size_t maxLines )
 		:	statistics( statistics ), maxLines( maxLines )
 	{
 	}
@@ -328,7 +479,7 @@ struct FormatStatistics
 	template<typename Metric>
 	std::string operator() ( const Metric &metric ) const
 	{
-		std::vector<PlugAndStatistics> v( statistics.begin(), statistics.end() );
+		std::vector<PlugAndStatistics<typename StatisticsMap::mapped_type>> v( statistics.begin(), statistics.end() );
 		std::sort( v.begin(), v.end(), MetricGreater<Metric>() );
 
 		std::vector<std::string> plugNames; plugNames.reserve( maxLines );
@@ -359,15 +510,16 @@ struct FormatStatistics
 		return s.str();
 	}
 
-	const PerformanceMonitor::StatisticsMap &statistics;
+	const StatisticsMap &statistics;
 	const size_t maxLines;
 
 };
 
+template<typename Statistics>
 struct FormatTotalStatistics
 {
 
-	FormatTotalStatistics( const PerformanceMonitor::Statistics &combinedStatistics )
+	FormatTotalStatistics( const Statistics &combinedStatistics )
 		:	combinedStatistics( combinedStatistics )
 	{
 	}
@@ -384,9 +536,46 @@ struct FormatTotalStatistics
 		return ResultType( "Total " + metric.description, s.str() );
 	}
 
-	const PerformanceMonitor::Statistics &combinedStatistics;
+	const Statistics &combinedStatistics;
 };
 
+// Formats the totals for all metrics followed by the
+// breakdowns by plug for each metric.
+template<typename MonitorType, typename MetricEnum>
+std::string formatAllStatistics( const std::string &title, const MonitorType &monitor, MetricEnum first, MetricEnum last, size_t maxLinesPerMetric )
+{
+	using StatisticsMap = typename MonitorType::StatisticsMap;
+	using Statistics = typename MonitorType::Statistics;
+
+	// First show totals
+	std::vector<std::string> names;
+	std::vector<std::string> values;
+	for( int m = (int)first; m <= (int)last; ++m )
+	{
+		const auto p = dispatchMetric( FormatTotalStatistics<Statistics>( monitor.combinedStatistics() ), static_cast<MetricEnum>( m ) );
+		names.push_back( p.first );
+		values.push_back( p.second );
+	}
+
+	std::stringstream ss;
+
+	ss << title << " Summary :\n\n";
+	outputItems( names, values, ss );
+	ss << "\n";
+
+	// Now show breakdowns by plugs in each category
+	std::string s = ss.str();
+	for( int m = (int)first; m <= (int)last; ++m )
+	{
+		s += dispatchMetric( FormatStatistics<StatisticsMap>( monitor.allStatistics(), maxLinesPerMetric ), static_cast<MetricEnum>( m ) );
+		if( m != (int)last )
+		{
+			s += "\n";
+		}
+	}
+	return s;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -408,6 +597,12 @@ double toDouble( const boost::chrono::duration<double> &v )
 	return v.count();
 }
 
+template<>
+double toDouble( const MemorySize &v )
+{
+	return static_cast<double>( v.bytes );
+}
+
 template<typename T>
 Color3f heat( const T &v, const T &m )
 {
@@ -415,10 +610,13 @@ Color3f heat( const T &v, const T &m )
 	return lerp( Color3f( 0 ), Color3f( 0.5, 0, 0 ), heatFactor );
 }
 
+template<typename StatisticsMap>
 struct Annotate
 {
 
-	Annotate( Node &root, const PerformanceMonitor::StatisticsMap &statistics, bool persistent )
+	using Statistics = typename StatisticsMap::mapped_type;
+
+	Annotate( Node &root, const StatisticsMap &statistics, bool persistent )
 		:	m_root( root ), m_statistics( statistics ), m_persistent( persistent )
 	{
 	}
@@ -434,18 +632,18 @@ struct Annotate
 	private :
 
 		Node &m_root;
-		const PerformanceMonitor::StatisticsMap &m_statistics;
+		const StatisticsMap &m_statistics;
 		const bool m_persistent;
 
 		template<typename Metric>
-		PerformanceMonitor::Statistics walk( Node &node, const Metric &metric ) const
+		Statistics walk( Node &node, const Metric &metric ) const
 		{
 			using Value = typename Metric::ResultType;
-			using ChildStatistics = std::pair<Node &, PerformanceMonitor::Statistics>;
+			using ChildStatistics = std::pair<Node &, Statistics>;
 
 			// Accumulate the statistics for all plugs belonging to this node.
 
-			PerformanceMonitor::Statistics result;
+			Statistics result;
 			for( Plug::RecursiveIterator plugIt( &node ); !plugIt.done(); ++plugIt )
 			{
 				auto it = m_statistics.find( plugIt->get() );
@@ -579,40 +777,22 @@ namespace MonitorAlgo
 
 std::string formatStatistics( const PerformanceMonitor &monitor, size_t maxLinesPerMetric )
 {
-	// First show totals
-	std::vector<std::string> names;
-	std::vector<std::string> values;
-	for( int m = First; m <= Last; ++m )
-	{
-		PerformanceMetric metric = static_cast<PerformanceMetric>( m );
-		FormatTotalStatistics::ResultType p =
-			dispatchMetric<FormatTotalStatistics>( FormatTotalStatistics( monitor.combinedStatistics() ), metric );
-		names.push_back( p.first );
-		values.push_back( p.second );
-	}
-
-	std::stringstream ss;
+	return formatAllStatistics( "PerformanceMonitor", monitor, First, Last, maxLinesPerMetric );
+}
 
-	ss << "PerformanceMonitor Summary :\n\n";
-	outputItems( names, values, ss );
-	ss << "\n";
+std::string formatStatistics( const PerformanceMonitor &monitor, PerformanceMetric metric, size_t maxLines )
+{
+	return dispatchMetric( FormatStatistics<PerformanceMonitor::StatisticsMap>( monitor.allStatistics(), maxLines ), metric );
+}
 
-	// Now show breakdowns by plugs in each category
-	std::string s = ss.str();
-	for( int m = First; m <= Last; ++m )
-	{
-		s += formatStatistics( monitor, static_cast<PerformanceMetric>( m ), maxLinesPerMetric );
-		if( m != Last )
-		{
-			s += "\n";
-		}
-	}
-	return s;
+std::string formatStatistics( const MemoryMonitor &monitor, size_t maxLinesPerMetric )
+{
+	return formatAllStatistics( "MemoryMonitor", monitor, MemoryMetric::First, MemoryMetric::Last, maxLinesPerMetric );
 }
 
-std::string formatStatistics( const PerformanceMonitor &monitor, PerformanceMetric metric, size_t maxLines )
+std::string formatStatistics( const MemoryMonitor &monitor, MemoryMetric metric, size_t maxLines )
 {
-	return dispatchMetric<FormatStatistics>( FormatStatistics( monitor.allStatistics(), maxLines ), metric );
+	return dispatchMetric( FormatStatistics<MemoryMonitor::StatisticsMap>( monitor.allStatistics(), maxLines ), metric );
 }
 
 void annotate( Node &root, const PerformanceMonitor &monitor, bool persistent )
@@ -625,7 +805,7 @@ void annotate( Node &root, const PerformanceMonitor &monitor, bool persistent )
 
 void annotate( Node &root, const PerformanceMonitor &monitor, PerformanceMetric metric, bool persistent )
 {
-	dispatchMetric<Annotate>( Annotate( root, monitor.allStatistics(), persistent ), metric );
+	dispatchMetric( Annotate<PerformanceMonitor::StatisticsMap>( root, monitor.allStatistics(), persistent ), metric );
 }
 
 void annotate( Node &root, const ContextMonitor &monitor, bool persistent )
@@ -633,6 +813,19 @@ void annotate( Node &root, const ContextMonitor &monitor, bool persistent )
 	annotateContextWalk( root, monitor.allStatistics(), persistent );
 }
 
+void annotate( Node &root, const MemoryMonitor &monitor, bool persistent )
+{
+	for( int m = (int)MemoryMetric::First; m <= (int)MemoryMetric::Last; ++m )
+	{
+		annotate( root, monitor, static_cast<MemoryMetric>( m ), persistent );
+	}
+}
+
+void annotate( Node &root, const MemoryMonitor &monitor, MemoryMetric metric, bool persistent )
+{
+	dispatchMetric( Annotate<MemoryMonitor::StatisticsMap>( root, monitor.allStatistics(), persistent ), metric );
+}
+
 void removePerformanceAnnotations( Node &root )
 {
 	for( int m = Gaffer::MonitorAlgo::First; m <= Gaffer::MonitorAlgo::Last; ++m )
@@ -660,6 +853,24 @@ void removeContextAnnotations( Node &root )
 	}
 }
 
+void removeMemoryAnnotations( Node &root )
+{
+	for( int m = (int)MemoryMetric::First; m <= (int)MemoryMetric::Last; ++m )
+	{
+		dispatchMetric(
+			[&root] ( auto metric ) {
+				MetadataAlgo::removeAnnotation( &root, metric.annotation );
+			},
+			static_cast<MemoryMetric>( m )
+		);
+	}
+
+	for( const auto &node : Node::Range( root ) )
+	{
+		removeMemoryAnnotations( *node );
+	}
+}
+
 } // namespace MonitorAlgo
 
 } // namespace Gaffer
@@ -39,11 +39,15 @@
 #include "Gaffer/Plug.h"
 #include "Gaffer/Process.h"
 
+#include <algorithm>
+#include <atomic>
+
 using namespace Gaffer;
 
 static IECore::InternedString g_hashType( "computeNode:hash" );
 static IECore::InternedString g_computeType( "computeNode:compute" );
 static PerformanceMonitor::Statistics g_emptyStatistics;
+static std::atomic<uint32_t> g_randomSeed( 0 );
 
 //////////////////////////////////////////////////////////////////////////
 // PerformanceMonitor::Statistics
@@ -82,7 +86,13 @@ bool PerformanceMonitor::Statistics::operator != ( const Statistics &rhs )
 // PerformanceMonitor
 //////////////////////////////////////////////////////////////////////////
 
-PerformanceMonitor::PerformanceMonitor()
+PerformanceMonitor::ThreadData::ThreadData()
+	:	randomState( ( g_randomSeed++ * 2654435761u ) | 1 )
+{
+}
+
+PerformanceMonitor::PerformanceMonitor( size_t sampleInterval )
+	:	m_sampleInterval( std::max<size_t>( sampleInterval, 1 ) )
 {
 }
 
@@ -90,6 +100,11 @@ PerformanceMonitor::~PerformanceMonitor()
 {
 }
 
+size_t PerformanceMonitor::sampleInterval() const
+{
+	return m_sampleInterval;
+}
+
 const PerformanceMonitor::StatisticsMap &PerformanceMonitor::allStatistics() const
 {
 	collate();
@@ -124,13 +139,29 @@ void PerformanceMonitor::processStarted( const Process *process )
 
 	ThreadData &threadData = m_threadData.local();
 
+	const bool sampled = sample( threadData );
+	boost::chrono::nanoseconds *billed = threadData.durationStack.empty() ? nullptr : threadData.durationStack.top();
+	if( !sampled && !billed )
+	{
+		// Nothing is being measured, so we can avoid the
+		// overhead of querying the clock.
+		threadData.durationStack.push( nullptr );
+		return;
+	}
+
 	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
-	if( !threadData.durationStack.empty() )
+	if( billed )
 	{
-		*(threadData.durationStack.top()) += now - threadData.then;
+		*billed += now - threadData.then;
 	}
 	threadData.then = now;
 
+	if( !sampled )
+	{
+		threadData.durationStack.push( nullptr );
+		return;
+	}
+
 	Statistics &s = threadData.statistics[process->plug()];
 	if( type == g_hashType )
 	{
@@ -153,22 +184,57 @@ void PerformanceMonitor::processFinished( const Process *process )
 	}
 
 	ThreadData &threadData = m_threadData.local();
-	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
-	*(threadData.durationStack.top()) += now - threadData.then;
+	boost::chrono::nanoseconds *billed = threadData.durationStack.top();
 	threadData.durationStack.pop();
+	if( !billed && ( threadData.durationStack.empty() || !threadData.durationStack.top() ) )
+	{
+		// Neither this process nor the one we're returning
+		// to is being measured.
+		return;
+	}
+
+	boost::chrono::high_resolution_clock::time_point now = boost::chrono::high_resolution_clock::now();
+	if( billed )
+	{
+		*billed += now - threadData.then;
+	}
 	threadData.then = now;
 }
 
+bool PerformanceMonitor::sample( ThreadData &threadData ) const
+{
+	if( m_sampleInterval == 1 )
+	{
+		return true;
+	}
+
+	// Xorshift generator. We use random rather than periodic sampling so
+	// that we don't alias with regular patterns of processes, such as the
+	// alternating hashes and computes made by `ValuePlug::getValue()`.
+	uint32_t &x = threadData.randomState;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return x % m_sampleInterval == 0;
+}
+
 void PerformanceMonitor::collate() const
 {
+	const boost::chrono::nanoseconds::rep durationScale = m_sampleInterval;
 	tbb::enumerable_thread_specific<ThreadData, tbb::cache_aligned_allocator<ThreadData>, tbb::ets_key_per_instance>::iterator it, eIt;
 	for( it = m_threadData.begin(), eIt = m_threadData.end(); it != eIt; ++it )
 	{
 		StatisticsMap &m = it->statistics;
 		for( StatisticsMap::const_iterator mIt = m.begin(), meIt = m.end(); mIt != meIt; ++mIt )
 		{
-			m_statistics[mIt->first] += mIt->second;
-			m_combinedStatistics += mIt->second;
+			const Statistics scaled(
+				mIt->second.hashCount * m_sampleInterval,
+				mIt->second.computeCount * m_sampleInterval,
+				mIt->second.hashDuration * durationScale,
+				mIt->second.computeDuration * durationScale
+			);
+			m_statistics[mIt->first] += scaled;
+			m_combinedStatistics += scaled;
 		}
 		m.clear();
 	}
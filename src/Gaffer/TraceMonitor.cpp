@@ -0,0 +1,289 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "Gaffer/TraceMonitor.h"
+
+#include "Gaffer/Context.h"
+#include "Gaffer/Plug.h"
+#include "Gaffer/Process.h"
+
+#include "IECore/Exception.h"
+
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <unordered_map>
+
+using namespace Gaffer;
+
+namespace
+{
+
+std::string escapedJSONString( const std::string &s )
+{
+	std::string result;
+	result.reserve( s.size() + 2 );
+	result.push_back( '"' );
+	for( char c : s )
+	{
+		switch( c )
+		{
+			case '"' :
+				result += "\\\"";
+				break;
+			case '\\' :
+				result += "\\\\";
+				break;
+			case '\n' :
+				result += "\\n";
+				break;
+			default :
+				if( (unsigned char)c < 0x20 )
+				{
+					result += fmt::format( "\\u{:04x}", (int)c );
+				}
+				else
+				{
+					result.push_back( c );
+				}
+		}
+	}
+	result.push_back( '"' );
+	return result;
+}
+
+// Trace event timestamps are measured in microseconds.
+std::string microseconds( boost::chrono::nanoseconds t )
+{
+	return fmt::format( "{:.3f}", t.count() / 1000.0 );
+}
+
+uint64_t processId( const Process *process )
+{
+	return reinterpret_cast<uintptr_t>( process );
+}
+
+} // namespace
+
+TraceMonitor::ThreadData::ThreadData()
+	:	id( ThreadMonitor::thisThreadId() )
+{
+}
+
+TraceMonitor::TraceMonitor( const std::vector<IECore::InternedString> &processMask )
+	:	m_processMask( processMask ), m_startTime( boost::chrono::high_resolution_clock::now() )
+{
+}
+
+TraceMonitor::~TraceMonitor()
+{
+}
+
+const TraceMonitor::Events &TraceMonitor::events() const
+{
+	collate();
+	return m_events;
+}
+
+void TraceMonitor::writeChromeTrace( std::ostream &stream ) const
+{
+	collate();
+
+	// Processes are usually invoked on the same thread as their parent,
+	// in which case the trace viewer infers the relationship from the
+	// nesting of events. But when a parent is waiting for processes on
+	// other threads, we need to record the relationship explicitly using
+	// flow events. Because process identifiers may be reused, we identify
+	// the parent event as the one that was running when the child started.
+
+	std::unordered_multimap<uint64_t, const Event *> eventsById;
+	std::set<ThreadMonitor::ThreadId> threadIds;
+	for( const auto &event : m_events )
+	{
+		eventsById.insert( { event.processId, &event } );
+		threadIds.insert( event.threadId );
+	}
+
+	auto findParent = [&eventsById] ( const Event &event ) -> const Event * {
+		auto range = eventsById.equal_range( event.parentId );
+		for( auto it = range.first; it != range.second; ++it )
+		{
+			if( it->second->start <= event.start && event.start <= it->second->finish )
+			{
+				return it->second;
+			}
+		}
+		return nullptr;
+	};
+
+	stream << "{\"traceEvents\":[\n";
+
+	bool first = true;
+	auto separator = [&first, &stream] {
+		if( !first )
+		{
+			stream << ",\n";
+		}
+		first = false;
+	};
+
+	for( auto threadId : threadIds )
+	{
+		separator();
+		stream << fmt::format(
+			"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{0},\"args\":{{\"name\":\"Thread {0}\"}}}}",
+			threadId
+		);
+	}
+
+	size_t flowId = 0;
+	for( const auto &event : m_events )
+	{
+		const std::string plugName = event.plug->fullName();
+
+		separator();
+		stream << fmt::format(
+			"{{\"name\":{},\"cat\":{},\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":0,\"tid\":{},"
+			"\"args\":{{\"plug\":{},\"context\":\"{}\",\"process\":\"{:x}\",\"parent\":\"{:x}\"}}}}",
+			escapedJSONString( plugName ), escapedJSONString( event.type.string() ),
+			microseconds( event.start ), microseconds( event.finish - event.start ),
+			event.threadId,
+			escapedJSONString( plugName ), event.contextHash.toString(), event.processId, event.parentId
+		);
+
+		if( !event.parentId )
+		{
+			continue;
+		}
+
+		const Event *parent = findParent( event );
+		if( !parent || parent->threadId == event.threadId )
+		{
+			continue;
+		}
+
+		separator();
+		stream << fmt::format(
+			"{{\"name\":\"parent\",\"cat\":\"process\",\"ph\":\"s\",\"id\":{},\"ts\":{},\"pid\":0,\"tid\":{}}},\n"
+			"{{\"name\":\"parent\",\"cat\":\"process\",\"ph\":\"f\",\"bp\":\"e\",\"id\":{},\"ts\":{},\"pid\":0,\"tid\":{}}}",
+			flowId, microseconds( event.start ), parent->threadId,
+			flowId, microseconds( event.start ), event.threadId
+		);
+		flowId++;
+	}
+
+	stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void TraceMonitor::writeChromeTrace( const std::string &fileName ) const
+{
+	std::ofstream f( fileName.c_str() );
+	if( !f.good() )
+	{
+		throw IECore::IOException( "Unable to open file \"" + fileName + "\"" );
+	}
+
+	writeChromeTrace( f );
+
+	if( !f.good() )
+	{
+		throw IECore::IOException( "Failed to write to \"" + fileName + "\"" );
+	}
+}
+
+void TraceMonitor::processStarted( const Process *process )
+{
+	if( masked( process ) )
+	{
+		return;
+	}
+
+	ThreadData &threadData = m_threadData.local();
+	threadData.stack.push_back( threadData.events.size() );
+	threadData.events.push_back( {
+		process->plug(), process->type(), process->context()->hash(),
+		processId( process ), processId( process->parent() ),
+		threadData.id,
+		boost::chrono::high_resolution_clock::now() - m_startTime,
+		boost::chrono::nanoseconds( 0 )
+	} );
+}
+
+void TraceMonitor::processFinished( const Process *process )
+{
+	if( masked( process ) )
+	{
+		return;
+	}
+
+	ThreadData &threadData = m_threadData.local();
+	assert( threadData.stack.size() );
+	threadData.events[threadData.stack.back()].finish = boost::chrono::high_resolution_clock::now() - m_startTime;
+	threadData.stack.pop_back();
+}
+
+bool TraceMonitor::masked( const Process *process ) const
+{
+	return m_processMask.size() && std::find( m_processMask.begin(), m_processMask.end(), process->type() ) == m_processMask.end();
+}
+
+void TraceMonitor::collate() const
+{
+	const size_t previousSize = m_events.size();
+	for( auto &threadData : m_threadData )
+	{
+		if( threadData.stack.size() )
+		{
+			// Processes are still running on this thread, and
+			// `stack` holds indices into `events`. Leave them
+			// for collection on a subsequent call.
+			continue;
+		}
+		std::move( threadData.events.begin(), threadData.events.end(), std::back_inserter( m_events ) );
+		threadData.events.clear();
+	}
+
+	if( m_events.size() != previousSize )
+	{
+		std::stable_sort(
+			m_events.begin(), m_events.end(),
+			[] ( const Event &a, const Event &b ) { return a.start < b.start; }
+		);
+	}
+}
@@ -41,17 +41,31 @@
 #include "Gaffer/ComputeNode.h"
 #include "Gaffer/Context.h"
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
+#include "Gaffer/Private/ScopedAssignment.h"
 #include "Gaffer/Process.h"
 
+#include "IECore/FileIndexedIO.h"
 #include "IECore/MessageHandler.h"
 
 #include "boost/bind/bind.hpp"
 
+#include "tbb/concurrent_unordered_map.h"
 #include "tbb/enumerable_thread_specific.h"
 
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 using namespace Gaffer;
@@ -94,6 +108,19 @@ const IECore::MurmurHash g_nullHash;
 // order to catch inaccuracies in the cache
 const uint64_t DIRTY_COUNT_RANGE_MAX = std::numeric_limits<uint64_t>::max() / 2;
 
+// Adds the statistics from an LRUCache into `result`.
+template<typename Cache>
+void accumulateCacheStatistics( const Cache &cache, ValuePlug::CacheStatistics &result )
+{
+	const typename Cache::Statistics statistics = cache.statistics();
+	result.hits += statistics.hits;
+	result.misses += statistics.misses;
+	result.evictions += statistics.evictions;
+	result.evictedCost += statistics.evictedCost;
+	result.contentionWaits += statistics.contentionWaits;
+	result.computeDuration += statistics.computeDuration;
+}
+
 } // namespace
 
 //////////////////////////////////////////////////////////////////////////
@@ -114,6 +141,11 @@ struct HashCacheKey
 	{
 	}
 
+	HashCacheKey( const ValuePlug *plug, const IECore::MurmurHash &contextHash, uint64_t dirtyCount )
+		:	plug( plug ), contextHash( contextHash ), dirtyCount( dirtyCount )
+	{
+	}
+
 	bool operator == ( const HashCacheKey &other ) const
 	{
 		return other.plug == plug && other.contextHash == contextHash && dirtyCount == other.dirtyCount;
@@ -263,6 +295,20 @@ class ValuePlug::HashProcess : public Process
 					}
 				}
 
+				// Any entry for the previous dirty count can never be used again,
+				// because dirty counts only increase. Remove it now rather than
+				// leaving it for the LRU rules, so that it doesn't displace entries
+				// for plugs that weren't affected by the edit. This is only a
+				// single lookup, so doesn't remove entries from older edits, but
+				// in the common case that hashes are pulled after every edit it
+				// keeps the cache free of stale entries. We deliberately leave
+				// `g_cache` alone : erasing from it would take a write lock on
+				// every miss, contending with the threads collaborating on it.
+				if( cacheKey.dirtyCount )
+				{
+					threadData.cache.erase( HashCacheKey( p, cacheKey.contextHash, cacheKey.dirtyCount - 1 ) );
+				}
+
 				// No value in local cache, so either compute it directly or get it via
 				// the global cache if it's expensive enough to warrant collaboration.
 				IECore::MurmurHash result;
@@ -366,6 +412,46 @@ class ValuePlug::HashProcess : public Process
 			}
 		}
 
+		static ValuePlug::CacheStatistics cacheStatistics()
+		{
+			ValuePlug::CacheStatistics result;
+			accumulateCacheStatistics( g_cache, result );
+			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
+			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
+			{
+				accumulateCacheStatistics( it->cache, result );
+			}
+			return result;
+		}
+
+		static void resetCacheStatistics()
+		{
+			// The statistics are stored atomically, so unlike `clearCache()`,
+			// it is safe to reset the thread-local caches from here.
+			g_cache.resetStatistics();
+			tbb::enumerable_thread_specific<ThreadData>::iterator it, eIt;
+			for( it = g_threadData.begin(), eIt = g_threadData.end(); it != eIt; ++it )
+			{
+				it->cache.resetStatistics();
+			}
+		}
+
+		// Returns true if the hash for `plug` in the context with `contextHash`
+		// is currently held by the global cache or the calling thread's cache.
+		// The caches for other threads are not considered, because they may
+		// be being modified concurrently.
+		static bool cached( const ValuePlug *plug, const IECore::MurmurHash &contextHash, uint64_t dirtyCount )
+		{
+			const HashCacheKey cacheKey( plug, contextHash, dirtyCount );
+			if( g_cache.cached( cacheKey ) )
+			{
+				return true;
+			}
+
+			ThreadData &threadData = g_threadData.local();
+			return !threadData.clearCache.load( std::memory_order_acquire ) && threadData.cache.cached( cacheKey );
+		}
+
 		static size_t totalCacheUsage()
 		{
 			size_t usage = g_cache.currentCost();
@@ -476,6 +562,451 @@ ValuePlug::HashProcess::CacheType ValuePlug::HashProcess::g_cache( CacheType::Ge
 std::atomic<uint64_t> ValuePlug::HashProcess::g_legacyGlobalDirtyCount( 0 );
 ValuePlug::HashCacheMode ValuePlug::HashProcess::g_hashCacheMode( defaultHashCacheMode() );
 
+//////////////////////////////////////////////////////////////////////////
+// The DiskCache provides an optional second tier for the compute cache.
+// Values evicted from memory are serialised to files named by their hash,
+// from where they can be reloaded by this or any other process sharing
+// the same directory.
+//////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+class DiskCache : boost::noncopyable
+{
+
+	public :
+
+		DiskCache()
+			:	m_enabled( false ), m_sizeLimit( 1024ull * 1024 * 1024 * 10 ), m_usage( 0 ), m_pendingCost( 0 ), m_stopping( false )
+		{
+		}
+
+		~DiskCache()
+		{
+			// Abandon any pending writes rather than delaying shutdown.
+			{
+				std::unique_lock<std::mutex> lock( m_queueMutex );
+				m_queue.clear();
+				m_pending.clear();
+				m_stopping = true;
+			}
+			m_queueChanged.notify_all();
+			if( m_writerThread.joinable() )
+			{
+				m_writerThread.join();
+			}
+		}
+
+		void setDirectory( const std::string &directory )
+		{
+			waitForWrites();
+			{
+				std::unique_lock<std::mutex> lock( m_directoryMutex );
+				m_directory = directory;
+				if( !directory.empty() )
+				{
+					// Create all the subdirectories up front, so that
+					// writes don't need to check for their existence.
+					for( int i = 0; i < 256; ++i )
+					{
+						std::filesystem::create_directories( m_directory / fmt::format( "{:02x}", i ) );
+					}
+				}
+				m_enabled = !directory.empty();
+			}
+			// Initialise `m_usage` from the files that already exist,
+			// which may have been written by other processes.
+			trim();
+
+			std::unique_lock<std::mutex> lock( m_queueMutex );
+			if( enabled() && !m_writerThread.joinable() )
+			{
+				m_writerThread = std::thread( [this] { writerLoop(); } );
+			}
+		}
+
+		std::string getDirectory() const
+		{
+			std::unique_lock<std::mutex> lock( m_directoryMutex );
+			return m_directory.string();
+		}
+
+		void setSizeLimit( size_t bytes )
+		{
+			m_sizeLimit = bytes;
+			trim();
+		}
+
+		size_t getSizeLimit() const
+		{
+			return m_sizeLimit;
+		}
+
+		size_t usage()
+		{
+			waitForWrites();
+			return m_enabled ? m_usage.load() : 0;
+		}
+
+		bool enabled() const
+		{
+			return m_enabled.load( std::memory_order_relaxed );
+		}
+
+		void clear()
+		{
+			{
+				std::unique_lock<std::mutex> lock( m_queueMutex );
+				m_queue.clear();
+				m_pending.clear();
+				m_pendingCost = 0;
+			}
+			waitForWrites();
+
+			const std::filesystem::path directory = directoryIfEnabled();
+			if( directory.empty() )
+			{
+				return;
+			}
+
+			// Remove the files but not the subdirectories, which
+			// writes assume to exist.
+			std::unique_lock<std::mutex> lock( m_trimMutex );
+			std::error_code ec;
+			for( const auto &entry : std::filesystem::recursive_directory_iterator( directory, ec ) )
+			{
+				if( entry.is_regular_file( ec ) )
+				{
+					std::filesystem::remove( entry.path(), ec );
+				}
+			}
+			m_usage = 0;
+
+			std::unique_lock<std::shared_mutex> indexLock( m_indexMutex );
+			m_index.clear();
+		}
+
+		// Returns the value stored for `hash`, or null if there is none.
+		IECore::ConstObjectPtr read( const IECore::MurmurHash &hash )
+		{
+			// The value may still be waiting to be written.
+			{
+				std::unique_lock<std::mutex> lock( m_queueMutex );
+				auto it = m_pending.find( hash );
+				if( it != m_pending.end() )
+				{
+					return it->second.value;
+				}
+			}
+
+			// Consult our index of the files on disk, so that we don't
+			// pay for a filesystem access on every miss.
+			const std::string hashString = hash.toString();
+			{
+				std::shared_lock<std::shared_mutex> indexLock( m_indexMutex );
+				if( !m_index.count( hashString ) )
+				{
+					return nullptr;
+				}
+			}
+
+			const std::filesystem::path fileName = this->fileName( hash );
+			if( fileName.empty() )
+			{
+				return nullptr;
+			}
+
+			std::error_code ec;
+
+			try
+			{
+				IECore::ConstIndexedIOPtr io = new IECore::FileIndexedIO( fileName.string(), {}, IECore::IndexedIO::Read );
+				IECore::ConstObjectPtr result = IECore::Object::load( io, g_objectEntry );
+				// Touch the file so that `trim()` treats it as recently used.
+				std::filesystem::last_write_time( fileName, std::filesystem::file_time_type::clock::now(), ec );
+				return result;
+			}
+			catch( ... )
+			{
+				// The file may have been removed by `trim()` in another process,
+				// or it may contain a type that hasn't been loaded into this
+				// process. Either way, we just treat it as a cache miss, and
+				// don't try again.
+				std::unique_lock<std::shared_mutex> indexLock( m_indexMutex );
+				m_index.erase( hashString );
+				return nullptr;
+			}
+		}
+
+		// Queues `value` to be written by a background thread, so that
+		// the computing thread that evicted it isn't delayed by
+		// serialisation and filesystem access.
+		void write( const IECore::MurmurHash &hash, const IECore::ConstObjectPtr &value, size_t cost )
+		{
+			{
+				std::unique_lock<std::mutex> lock( m_queueMutex );
+				if( !m_writerThread.joinable() || m_pendingCost + cost > g_maxPendingCost )
+				{
+					// Values are being evicted faster than we can write
+					// them. Drop this one rather than holding on to
+					// unbounded amounts of memory.
+					return;
+				}
+				if( !m_pending.emplace( hash, PendingWrite{ value, cost } ).second )
+				{
+					return;
+				}
+				m_queue.push_back( hash );
+				m_pendingCost += cost;
+			}
+			m_queueChanged.notify_one();
+		}
+
+	private :
+
+		struct PendingWrite
+		{
+			IECore::ConstObjectPtr value;
+			size_t cost;
+		};
+
+		void writerLoop()
+		{
+			std::unique_lock<std::mutex> lock( m_queueMutex );
+			while( true )
+			{
+				if( !m_queueChanged.wait_for( lock, g_rescanInterval, [this] { return m_stopping || !m_queue.empty(); } ) )
+				{
+					// Nothing to write for a while. Rescan the directory so that
+					// our index picks up files written by other processes.
+					lock.unlock();
+					trim();
+					lock.lock();
+					continue;
+				}
+
+				if( m_stopping )
+				{
+					return;
+				}
+
+				// Leave the value in `m_pending` while we write it,
+				// so that `read()` can still find it.
+				const IECore::MurmurHash hash = m_queue.front();
+				m_queue.pop_front();
+				const PendingWrite pending = m_pending.at( hash );
+				m_writing = true;
+				lock.unlock();
+				writeFile( hash, pending.value.get() );
+				lock.lock();
+				m_writing = false;
+				if( m_pending.erase( hash ) )
+				{
+					m_pendingCost -= pending.cost;
+				}
+				m_queueChanged.notify_all();
+			}
+		}
+
+		void waitForWrites()
+		{
+			std::unique_lock<std::mutex> lock( m_queueMutex );
+			m_queueChanged.wait( lock, [this] { return m_stopping || ( m_queue.empty() && !m_writing ); } );
+		}
+
+		void writeFile( const IECore::MurmurHash &hash, const IECore::Object *value )
+		{
+			const std::filesystem::path fileName = this->fileName( hash );
+			if( fileName.empty() )
+			{
+				return;
+			}
+
+			std::error_code ec;
+			if( std::filesystem::exists( fileName, ec ) )
+			{
+				// Already written by us or by another process.
+				return;
+			}
+
+			// We write to a uniquely named temporary file and then rename it
+			// into place, so that readers in other processes never see a
+			// partially written file.
+			const std::filesystem::path tempFileName = fileName.parent_path() / fmt::format( "{}.{:016x}.tmp", hash.toString(), m_random() );
+			try
+			{
+				IECore::IndexedIOPtr io = new IECore::FileIndexedIO( tempFileName.string(), {}, IECore::IndexedIO::Write );
+				value->save( io, g_objectEntry );
+			}
+			catch( ... )
+			{
+				// Not all objects support serialisation.
+				std::filesystem::remove( tempFileName, ec );
+				return;
+			}
+
+			const uintmax_t fileSize = std::filesystem::file_size( tempFileName, ec );
+			std::filesystem::rename( tempFileName, fileName, ec );
+			if( ec )
+			{
+				std::filesystem::remove( tempFileName, ec );
+				return;
+			}
+
+			{
+				std::unique_lock<std::shared_mutex> indexLock( m_indexMutex );
+				m_index.insert( hash.toString() );
+			}
+
+			if( ( m_usage += fileSize ) > m_sizeLimit )
+			{
+				trim();
+			}
+		}
+
+		std::filesystem::path directoryIfEnabled() const
+		{
+			if( !enabled() )
+			{
+				return std::filesystem::path();
+			}
+			std::unique_lock<std::mutex> lock( m_directoryMutex );
+			return m_directory;
+		}
+
+		std::filesystem::path fileName( const IECore::MurmurHash &hash ) const
+		{
+			std::filesystem::path directory = directoryIfEnabled();
+			if( directory.empty() )
+			{
+				return directory;
+			}
+			// Distribute files among subdirectories to keep
+			// directory sizes manageable.
+			const std::string hashString = hash.toString();
+			return directory / hashString.substr( 0, 2 ) / ( hashString + ".fio" );
+		}
+
+		// Scans the directory to update `m_usage`, removing the least
+		// recently used files if we are over the size limit. Since the
+		// directory may be shared with other processes, this is the only
+		// reliable way of determining the total usage.
+		void trim()
+		{
+			const std::filesystem::path directory = directoryIfEnabled();
+			if( directory.empty() )
+			{
+				return;
+			}
+
+			std::unique_lock<std::mutex> lock( m_trimMutex, std::try_to_lock );
+			if( !lock.owns_lock() )
+			{
+				// Another thread is already trimming.
+				return;
+			}
+
+			struct File
+			{
+				std::filesystem::file_time_type time;
+				uintmax_t size;
+				std::filesystem::path path;
+			};
+
+			std::vector<File> files;
+			std::unordered_set<std::string> index;
+			uintmax_t usage = 0;
+			std::error_code ec;
+			for( const auto &entry : std::filesystem::recursive_directory_iterator( directory, ec ) )
+			{
+				if( !entry.is_regular_file( ec ) || entry.path().extension() != ".fio" )
+				{
+					continue;
+				}
+				const uintmax_t size = entry.file_size( ec );
+				files.push_back( { entry.last_write_time( ec ), size, entry.path() } );
+				index.insert( entry.path().stem().string() );
+				usage += size;
+			}
+
+			if( usage > m_sizeLimit )
+			{
+				// Remove the least recently used files until we're comfortably
+				// under the limit, so that we don't need to trim again
+				// immediately on the next write.
+				const uintmax_t targetUsage = m_sizeLimit - m_sizeLimit / 10;
+				std::sort(
+					files.begin(), files.end(),
+					[] ( const File &a, const File &b ) { return a.time < b.time; }
+				);
+				for( const auto &file : files )
+				{
+					if( usage <= targetUsage )
+					{
+						break;
+					}
+					if( std::filesystem::remove( file.path, ec ) )
+					{
+						usage -= file.size;
+						index.erase( file.path.stem().string() );
+					}
+				}
+			}
+
+			m_usage = usage;
+
+			std::unique_lock<std::shared_mutex> indexLock( m_indexMutex );
+			m_index.swap( index );
+		}
+
+		static const IECore::IndexedIO::EntryID g_objectEntry;
+		// Limit on the memory held by values waiting to be written.
+		static const size_t g_maxPendingCost = 256 * 1024 * 1024;
+		static constexpr std::chrono::seconds g_rescanInterval{ 30 };
+
+		std::atomic_bool m_enabled;
+		std::atomic_size_t m_sizeLimit;
+		std::atomic_size_t m_usage;
+
+		mutable std::mutex m_directoryMutex;
+		std::filesystem::path m_directory;
+
+		std::mutex m_trimMutex;
+
+		// Names of the files in the directory, as of the last call to
+		// `trim()`, plus any we have written since.
+		std::shared_mutex m_indexMutex;
+		std::unordered_set<std::string> m_index;
+
+		std::mutex m_queueMutex;
+		std::condition_variable m_queueChanged;
+		std::deque<IECore::MurmurHash> m_queue;
+		std::unordered_map<IECore::MurmurHash, PendingWrite, boost::hash<IECore::MurmurHash>> m_pending;
+		size_t m_pendingCost;
+		bool m_writing = false;
+		bool m_stopping;
+		std::thread m_writerThread;
+		// Only used by `m_writerThread`.
+		std::mt19937_64 m_random{ std::random_device()() };
+
+};
+
+const IECore::IndexedIO::EntryID DiskCache::g_objectEntry( "object" );
+
+DiskCache g_diskCache;
+
+// Small values are cheap to recompute relative to the filesystem
+// overhead of storing them, so we only write values larger than this.
+const size_t g_diskCacheMinimumCost = 4096;
+
+// Set while `ComputeProcess::clearCache()` or `removeCachedValue()` is
+// running, so that values are discarded rather than written to the disk
+// cache.
+thread_local bool g_clearingCache = false;
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 // The ComputeProcess manages the task of calling ComputeNode::compute()
 // and storing a cache of recently computed results.
@@ -490,22 +1021,172 @@ class ValuePlug::ComputeProcess : public Process
 
 		static size_t getCacheMemoryLimit()
 		{
-			return g_cache.getMaxCost();
+			return g_defaultPartition.cache.getMaxCost();
 		}
 
 		static void setCacheMemoryLimit( size_t bytes )
 		{
-			return g_cache.setMaxCost( bytes );
+			return g_defaultPartition.cache.setMaxCost( bytes );
 		}
 
 		static size_t cacheMemoryUsage()
 		{
-			return g_cache.currentCost();
+			size_t result = g_defaultPartition.cache.currentCost();
+			for( const auto &p : g_partitions )
+			{
+				result += p.second->cache.currentCost();
+			}
+			return result;
 		}
 
 		static void clearCache()
 		{
-			g_cache.clear();
+			Private::ScopedAssignment<bool> clearingCache( g_clearingCache, true );
+			g_defaultPartition.cache.clear();
+			for( const auto &p : g_partitions )
+			{
+				p.second->cache.clear();
+			}
+		}
+
+		static void removeCachedValue( const ValuePlug *plug )
+		{
+			const ValuePlug *p = sourcePlug( plug );
+
+			const ComputeNode *computeNode = nullptr;
+			if( !p->getInput() )
+			{
+				if( p->direction()==In || !(computeNode = IECore::runTimeCast<const ComputeNode>( p->node() )) )
+				{
+					// Value is stored on the plug, not in the cache.
+					return;
+				}
+			}
+
+			CacheType &cache = partition( computeNode, p ).cache;
+			const IECore::MurmurHash hash = p->ValuePlug::hash();
+			Private::ScopedAssignment<bool> clearingCache( g_clearingCache, true );
+			cache.erase( hash );
+			if( &cache != &g_defaultPartition.cache )
+			{
+				// The value may have been computed before the partition
+				// was created, in which case it will be in the default
+				// partition instead.
+				g_defaultPartition.cache.erase( hash );
+			}
+		}
+
+		static std::vector<IECore::InternedString> cachePartitions()
+		{
+			std::vector<IECore::InternedString> result = { g_defaultPartitionName };
+			for( const auto &p : g_partitions )
+			{
+				result.push_back( p.first );
+			}
+			std::sort( result.begin(), result.end(), [] ( const IECore::InternedString &a, const IECore::InternedString &b ) { return a.string() < b.string(); } );
+			return result;
+		}
+
+		static size_t getCachePartitionMemoryLimit( const IECore::InternedString &name )
+		{
+			return findPartition( name ).cache.getMaxCost();
+		}
+
+		static void setCachePartitionMemoryLimit( const IECore::InternedString &name, size_t bytes )
+		{
+			if( name == g_defaultPartitionName )
+			{
+				setCacheMemoryLimit( bytes );
+				return;
+			}
+
+			Partitions::const_iterator it = g_partitions.find( name );
+			if( it == g_partitions.end() )
+			{
+				// Partitions are never removed, so there is no need to
+				// worry about concurrent lookups in `findPartition()` seeing
+				// a dangling pointer.
+				it = g_partitions.emplace( name, std::make_unique<Partition>( bytes ) ).first;
+				g_partitionsExist = true;
+			}
+			it->second->cache.setMaxCost( bytes );
+		}
+
+		static size_t cachePartitionMemoryUsage( const IECore::InternedString &name )
+		{
+			return findPartition( name ).cache.currentCost();
+		}
+
+		static void setCacheEvictionMode( CacheEvictionMode mode )
+		{
+			g_evictionMode = mode;
+			g_defaultPartition.cache.setEvictionMode( cacheEvictionMode( mode ) );
+			for( const auto &p : g_partitions )
+			{
+				p.second->cache.setEvictionMode( cacheEvictionMode( mode ) );
+			}
+		}
+
+		static CacheEvictionMode getCacheEvictionMode()
+		{
+			return g_evictionMode;
+		}
+
+		static CacheStatistics cacheStatistics()
+		{
+			CacheStatistics result;
+			accumulateCacheStatistics( g_defaultPartition.cache, result );
+			for( const auto &p : g_partitions )
+			{
+				accumulateCacheStatistics( p.second->cache, result );
+			}
+			return result;
+		}
+
+		static CacheStatistics cachePartitionStatistics( const IECore::InternedString &name )
+		{
+			CacheStatistics result;
+			accumulateCacheStatistics( findPartition( name ).cache, result );
+			return result;
+		}
+
+		static bool cached( const IECore::MurmurHash &hash )
+		{
+			if( g_defaultPartition.cache.cached( hash ) )
+			{
+				return true;
+			}
+			for( const auto &p : g_partitions )
+			{
+				if( p.second->cache.cached( hash ) )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		// Returns the result of `process`, provided that it is a ComputeProcess
+		// which completed successfully and is now being destroyed. Intended for
+		// use from `Monitor::processFinished()`.
+		static const IECore::Object *result( const Process *process, const IECore::MurmurHash *&cacheKey )
+		{
+			const LastResult &lastResult = g_lastResult;
+			if( lastResult.process != process )
+			{
+				return nullptr;
+			}
+			cacheKey = lastResult.cacheKey ? &lastResult.cacheKeyStorage : nullptr;
+			return lastResult.result;
+		}
+
+		static void resetCacheStatistics()
+		{
+			g_defaultPartition.cache.resetStatistics();
+			for( const auto &p : g_partitions )
+			{
+				p.second->cache.resetStatistics();
+			}
 		}
 
 		static const IECore::Object *value( const ValuePlug *plug, IECore::ConstObjectPtr &owner, const IECore::MurmurHash *precomputedHash )
@@ -551,10 +1232,12 @@ class ValuePlug::ComputeProcess : public Process
 
 			if( cachePolicy == CachePolicy::Uncached )
 			{
-				owner = ComputeProcess( p, plug, computeNode ).run();
+				owner = ComputeProcess( p, plug, computeNode, /* cacheKey = */ nullptr ).run();
 				return owner.get();
 			}
 
+			CacheType &cache = partition( computeNode, p ).cache;
+
 			const ThreadState &threadState = ThreadState::current();
 
 			// If caching is on, then we first check for an already-cached value
@@ -571,12 +1254,39 @@ class ValuePlug::ComputeProcess : public Process
 
 			if( !Process::forceMonitoring( threadState, plug, staticType ) )
 			{
-				if( auto result = g_cache.getIfCached( hash ) )
+				if( auto result = cache.getIfCached( hash ) )
 				{
 					// Move avoids unnecessary additional addRef/removeRef.
 					owner = std::move( *result );
 					return owner.get();
 				}
+
+				if( &cache != &g_defaultPartition.cache )
+				{
+					// Values computed before the partition was created
+					// will have been stored in the default partition. Adopt
+					// them rather than recomputing them.
+					if( auto result = g_defaultPartition.cache.getIfCached( hash ) )
+					{
+						owner = std::move( *result );
+						cache.setIfUncached( hash, owner, cacheCostFunction );
+						Private::ScopedAssignment<bool> clearingCache( g_clearingCache, true );
+						g_defaultPartition.cache.erase( hash );
+						return owner.get();
+					}
+				}
+
+				// Fall back to the disk cache, promoting any value found
+				// there back into memory.
+				if( g_diskCache.enabled() )
+				{
+					if( IECore::ConstObjectPtr result = g_diskCache.read( hash ) )
+					{
+						cache.setIfUncached( hash, result, cacheCostFunction );
+						owner = std::move( result );
+						return owner.get();
+					}
+				}
 			}
 
 			// The value isn't in the cache, so we'll need to compute it,
@@ -589,7 +1299,21 @@ class ValuePlug::ComputeProcess : public Process
 				// lightweight enough and unlikely enough to be shared that in
 				// the worst case it's OK to do it redundantly on a few threads
 				// before it gets cached.
-				owner = ComputeProcess( p, plug, computeNode ).run();
+				//
+				// The compute is only timed when the CostAware eviction mode
+				// needs it, because these computes are typically so quick that
+				// reading the clock would be a significant overhead.
+				std::chrono::nanoseconds computeDuration( 0 );
+				if( g_evictionMode.load( std::memory_order_relaxed ) == CacheEvictionMode::CostAware )
+				{
+					const auto computeStart = std::chrono::steady_clock::now();
+					owner = ComputeProcess( p, plug, computeNode, &hash ).run();
+					computeDuration = std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now() - computeStart );
+				}
+				else
+				{
+					owner = ComputeProcess( p, plug, computeNode, &hash ).run();
+				}
 				// Store the value in the cache, but only if it isn't there already.
 				// The check is useful because it's common for an upstream compute
 				// triggered by us to have already done the work, and calling
@@ -600,13 +1324,13 @@ class ValuePlug::ComputeProcess : public Process
 				// upstream node will already have computed the same result) and the
 				// attribute data itself consists of many small objects for which
 				// computing memory usage is slow.
-				g_cache.setIfUncached( hash, owner, cacheCostFunction );
+				cache.setIfUncached( hash, owner, cacheCostFunction, computeDuration );
 				return owner.get();
 			}
 			else
 			{
 				owner = acquireCollaborativeResult<ComputeProcess>(
-					hash, p, plug, computeNode
+					cache, hash, p, plug, computeNode, &hash
 				);
 				return owner.get();
 			}
@@ -633,9 +1357,13 @@ class ValuePlug::ComputeProcess : public Process
 
 		// Interface required by `Process::acquireCollaborativeResult()`.
 
-		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode )
-			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode )
+		ComputeProcess( const ValuePlug *plug, const ValuePlug *destinationPlug, const ComputeNode *computeNode, const IECore::MurmurHash *cacheKey )
+			:	Process( staticType, plug, destinationPlug ), m_computeNode( computeNode ), m_cacheKey( cacheKey )
 		{
+			if( monitored() )
+			{
+				g_lastResult.process = nullptr;
+			}
 		}
 
 		IECore::ConstObjectPtr run() const
@@ -667,6 +1395,22 @@ class ValuePlug::ComputeProcess : public Process
 				{
 					throw IECore::Exception( "Compute did not set plug value." );
 				}
+				// Record the result so that it is available to `result()`
+				// while our destructor notifies any monitors. We can't use
+				// our own members for that, because they will already have
+				// been destroyed by the time `~Process()` runs. The caller
+				// keeps the result alive in the meantime.
+				if( monitored() )
+				{
+					LastResult &lastResult = g_lastResult;
+					lastResult.process = this;
+					lastResult.result = m_result.get();
+					lastResult.cacheKey = m_cacheKey != nullptr;
+					if( m_cacheKey )
+					{
+						lastResult.cacheKeyStorage = *m_cacheKey;
+					}
+				}
 				// Move to avoid unnecessary reference count increment/decrement - we don't
 				// need `m_result` any more.
 				return std::move( m_result );
@@ -679,7 +1423,6 @@ class ValuePlug::ComputeProcess : public Process
 
 		using ResultType = IECore::ConstObjectPtr;
 		using CacheType = IECorePreview::LRUCache<IECore::MurmurHash, IECore::ConstObjectPtr, IECorePreview::LRUCachePolicy::Parallel>;
-		static CacheType g_cache;
 
 		static size_t cacheCostFunction( const IECore::ConstObjectPtr &v )
 		{
@@ -688,15 +1431,114 @@ class ValuePlug::ComputeProcess : public Process
 
 	private :
 
+		struct Partition : boost::noncopyable
+		{
+
+			Partition( size_t maxCost )
+				:	// Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
+					cache(
+						CacheType::GetterFunction(), maxCost,
+						[this] ( const IECore::MurmurHash &hash, const IECore::ConstObjectPtr &value ) { removed( hash, value ); },
+						/* cacheErrors = */ false
+					)
+			{
+				cache.setEvictionMode( cacheEvictionMode( g_evictionMode ) );
+			}
+
+			CacheType cache;
+
+			private :
+
+				void removed( const IECore::MurmurHash &hash, const IECore::ConstObjectPtr &value )
+				{
+					if( g_clearingCache )
+					{
+						return;
+					}
+
+					if( g_diskCache.enabled() )
+					{
+						const size_t cost = value->memoryUsage();
+						if( cost >= g_diskCacheMinimumCost )
+						{
+							g_diskCache.write( hash, value, cost );
+						}
+					}
+				}
+
+		};
+
+		static CacheType::EvictionMode cacheEvictionMode( CacheEvictionMode mode )
+		{
+			return mode == CacheEvictionMode::CostAware ? CacheType::EvictionMode::CostAware : CacheType::EvictionMode::LRU;
+		}
+
+		// Returns the partition with the specified name, falling back
+		// to the default partition if it doesn't exist.
+		static Partition &findPartition( const IECore::InternedString &name )
+		{
+			if( name == g_defaultPartitionName )
+			{
+				return g_defaultPartition;
+			}
+
+			Partitions::const_iterator it = g_partitions.find( name );
+			return it != g_partitions.end() ? *it->second : g_defaultPartition;
+		}
+
+		// Returns the partition that values for `plug` should be stored in.
+		static Partition &partition( const ComputeNode *computeNode, const ValuePlug *plug )
+		{
+			if( !computeNode || !g_partitionsExist.load( std::memory_order_relaxed ) )
+			{
+				// Fast path, avoiding the virtual call and the map lookup
+				// in the common case that no partitions have been created.
+				return g_defaultPartition;
+			}
+			return findPartition( computeNode->computeCachePartition( plug ) );
+		}
+
+		struct PartitionNameHash
+		{
+			size_t operator()( const IECore::InternedString &name ) const
+			{
+				// InternedStrings are unique, so we can simply hash the address.
+				return std::hash<const char *>()( name.c_str() );
+			}
+		};
+
+		using Partitions = tbb::concurrent_unordered_map<IECore::InternedString, std::unique_ptr<Partition>, PartitionNameHash>;
+
+		struct LastResult
+		{
+			const Process *process = nullptr;
+			const IECore::Object *result = nullptr;
+			bool cacheKey = false;
+			IECore::MurmurHash cacheKeyStorage;
+		};
+
+		static thread_local LastResult g_lastResult;
+
+		static std::atomic<CacheEvictionMode> g_evictionMode;
+		static const IECore::InternedString g_defaultPartitionName;
+		static Partition g_defaultPartition;
+		static Partitions g_partitions;
+		static std::atomic_bool g_partitionsExist;
+
 		const ComputeNode *m_computeNode;
+		const IECore::MurmurHash *m_cacheKey;
 		IECore::ConstObjectPtr m_result;
 
 };
 
 const IECore::InternedString ValuePlug::ComputeProcess::staticType( ValuePlug::computeProcessType() );
-// Using a null `GetterFunction` because it will never get called, because we only ever call `getIfCached()`.
+thread_local ValuePlug::ComputeProcess::LastResult ValuePlug::ComputeProcess::g_lastResult;
+std::atomic<ValuePlug::CacheEvictionMode> ValuePlug::ComputeProcess::g_evictionMode( ValuePlug::CacheEvictionMode::LRU );
+const IECore::InternedString ValuePlug::ComputeProcess::g_defaultPartitionName( "" );
 // Note : The default size here is overridden by `startup/Gaffer/cache.py`.
-ValuePlug::ComputeProcess::CacheType ValuePlug::ComputeProcess::g_cache( CacheType::GetterFunction(), 1024 * 1024 * 1024 * 1, CacheType::RemovalCallback(), /* cacheErrors = */ false ); // 1 gig
+ValuePlug::ComputeProcess::Partition ValuePlug::ComputeProcess::g_defaultPartition( 1024 * 1024 * 1024 * 1 ); // 1 gig
+ValuePlug::ComputeProcess::Partitions ValuePlug::ComputeProcess::g_partitions;
+std::atomic_bool ValuePlug::ComputeProcess::g_partitionsExist( false );
 
 //////////////////////////////////////////////////////////////////////////
 // SetValueAction implementation
@@ -1129,8 +1971,10 @@ void ValuePlug::dirty()
 {
 	// All entries in the hash cache for this plug are now invalid.
 	// Increment `m_dirtyCount` so that we won't try to reuse them.
-	// The invalid entries will be evicted by the LRU rules in due
-	// course.
+	// Entries for plugs that weren't dirtied remain valid. The
+	// invalid entries are removed when the hash is next computed
+	// in the same context, or otherwise evicted by the LRU rules
+	// in due course.
 	m_dirtyCount = std::min( DIRTY_COUNT_RANGE_MAX, m_dirtyCount + 1 );
 
 	HashProcess::dirtyLegacyCache();
@@ -1154,6 +1998,94 @@ size_t ValuePlug::cacheMemoryUsage()
 void ValuePlug::clearCache()
 {
 	ComputeProcess::clearCache();
+	cacheClearedSignal()();
+}
+
+ValuePlug::CacheClearedSignal &ValuePlug::cacheClearedSignal()
+{
+	static CacheClearedSignal g_cacheClearedSignal;
+	return g_cacheClearedSignal;
+}
+
+void ValuePlug::removeCachedValue() const
+{
+	ComputeProcess::removeCachedValue( this );
+}
+
+std::vector<IECore::InternedString> ValuePlug::cachePartitions()
+{
+	return ComputeProcess::cachePartitions();
+}
+
+size_t ValuePlug::getCachePartitionMemoryLimit( const IECore::InternedString &partition )
+{
+	return ComputeProcess::getCachePartitionMemoryLimit( partition );
+}
+
+void ValuePlug::setCachePartitionMemoryLimit( const IECore::InternedString &partition, size_t bytes )
+{
+	ComputeProcess::setCachePartitionMemoryLimit( partition, bytes );
+}
+
+size_t ValuePlug::cachePartitionMemoryUsage( const IECore::InternedString &partition )
+{
+	return ComputeProcess::cachePartitionMemoryUsage( partition );
+}
+
+void ValuePlug::setCacheEvictionMode( CacheEvictionMode mode )
+{
+	ComputeProcess::setCacheEvictionMode( mode );
+}
+
+ValuePlug::CacheEvictionMode ValuePlug::getCacheEvictionMode()
+{
+	return ComputeProcess::getCacheEvictionMode();
+}
+
+ValuePlug::CacheStatistics ValuePlug::cacheStatistics()
+{
+	return ComputeProcess::cacheStatistics();
+}
+
+void ValuePlug::resetCacheStatistics()
+{
+	ComputeProcess::resetCacheStatistics();
+}
+
+ValuePlug::CacheStatistics ValuePlug::cachePartitionStatistics( const IECore::InternedString &partition )
+{
+	return ComputeProcess::cachePartitionStatistics( partition );
+}
+
+
+void ValuePlug::setDiskCacheDirectory( const std::string &directory )
+{
+	g_diskCache.setDirectory( directory );
+}
+
+std::string ValuePlug::getDiskCacheDirectory()
+{
+	return g_diskCache.getDirectory();
+}
+
+size_t ValuePlug::getDiskCacheSizeLimit()
+{
+	return g_diskCache.getSizeLimit();
+}
+
+void ValuePlug::setDiskCacheSizeLimit( size_t bytes )
+{
+	g_diskCache.setSizeLimit( bytes );
+}
+
+size_t ValuePlug::diskCacheUsage()
+{
+	return g_diskCache.usage();
+}
+
+void ValuePlug::clearDiskCache()
+{
+	g_diskCache.clear();
 }
 
 size_t ValuePlug::getHashCacheSizeLimit()
@@ -1176,6 +2108,16 @@ size_t ValuePlug::hashCacheTotalUsage()
 	return HashProcess::totalCacheUsage();
 }
 
+ValuePlug::CacheStatistics ValuePlug::hashCacheStatistics()
+{
+	return HashProcess::cacheStatistics();
+}
+
+void ValuePlug::resetHashCacheStatistics()
+{
+	HashProcess::resetCacheStatistics();
+}
+
 void ValuePlug::setHashCacheMode( ValuePlug::HashCacheMode hashCacheMode )
 {
 	HashProcess::setHashCacheMode( hashCacheMode );
@@ -1197,3 +2139,18 @@ const IECore::InternedString &ValuePlug::computeProcessType()
 	static IECore::InternedString g_computeProcessType( "computeNode:compute" );
 	return g_computeProcessType;
 }
+
+const IECore::Object *ValuePlug::computeResult( const Process *computeProcess, const IECore::MurmurHash *&cacheKey )
+{
+	return ComputeProcess::result( computeProcess, cacheKey );
+}
+
+bool ValuePlug::computeCacheContains( const IECore::MurmurHash &cacheKey )
+{
+	return ComputeProcess::cached( cacheKey );
+}
+
+bool ValuePlug::hashCacheContains( const ValuePlug *plug, const IECore::MurmurHash &contextHash, uint64_t dirtyCount )
+{
+	return HashProcess::cached( plug, contextHash, dirtyCount );
+}
@@ -35,6 +35,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
 
 #include "GafferCycles/IECoreCyclesPreview/CameraAlgo.h"
 #include "GafferCycles/IECoreCyclesPreview/GeometryAlgo.h"
@@ -47,6 +48,7 @@
 
 #include "IECoreScene/Camera.h"
 #include "IECoreScene/CurvesPrimitive.h"
+#include "IECoreScene/MeshAlgo.h"
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/Shader.h"
 #include "IECoreScene/SpherePrimitive.h"
@@ -1380,6 +1382,25 @@ IE_CORE_DECLAREPTR( AttributesCache )
 namespace
 {
 
+// Polygon meshes in Cycles must consist of triangles only. Triangulation
+// doesn't depend on Cycles, so we share the result with other renders of the
+// same mesh. `hash` must identify `object`, and is provided by the caller so
+// that we don't need to hash the mesh again.
+IECore::ConstObjectPtr triangulate( const IECore::Object *object, const IECore::MurmurHash &hash )
+{
+	const IECoreScene::MeshPrimitive *mesh = IECore::runTimeCast<const IECoreScene::MeshPrimitive>( object );
+	if( !mesh || mesh->interpolation() == "catmullClark" || mesh->maxVerticesPerFace() <= 3 )
+	{
+		return object;
+	}
+
+	IECore::MurmurHash key = hash;
+	key.append( "IECoreCycles::MeshAlgo::triangulate" );
+	return IECoreScenePreview::TranslationCache::get(
+		key, [mesh] { return IECoreScene::MeshAlgo::triangulate( mesh ); }
+	);
+}
+
 class Instance
 {
 
@@ -1455,7 +1476,8 @@ class InstanceCache : public IECore::RefCounted
 
 			bool isPrototype = false;
 
-			IECore::MurmurHash h = object->hash();
+			const IECore::MurmurHash objectHash = object->hash();
+			IECore::MurmurHash h = objectHash;
 			cyclesAttributes->hashGeometry( object, h );
 
 			SharedCGeometryPtr cgeo;
@@ -1471,7 +1493,7 @@ class InstanceCache : public IECore::RefCounted
 				if( m_geometry.insert( writeAccessor, h ) )
 				{
 					isPrototype = true;
-					writeAccessor->second = convert( object, cyclesAttributes, nodeName );
+					writeAccessor->second = convert( triangulate( object, objectHash ).get(), cyclesAttributes, nodeName );
 				}
 				cgeo = writeAccessor->second;
 			}
@@ -1499,15 +1521,8 @@ class InstanceCache : public IECore::RefCounted
 
 			bool isPrototype = false;
 
-			IECore::MurmurHash h;
-			for( std::vector<const IECore::Object *>::const_iterator it = samples.begin(), eIt = samples.end(); it != eIt; ++it )
-			{
-				(*it)->hash( h );
-			}
-			for( std::vector<float>::const_iterator it = times.begin(), eIt = times.end(); it != eIt; ++it )
-			{
-				h.append( *it );
-			}
+			const IECore::MurmurHash samplesHash = IECoreScenePreview::TranslationCache::samplesHash( samples, times );
+			IECore::MurmurHash h = samplesHash;
 			cyclesAttributes->hashGeometry( samples.front(), h );
 
 			SharedCGeometryPtr cgeo;
@@ -1523,7 +1538,16 @@ class InstanceCache : public IECore::RefCounted
 				if( m_geometry.insert( writeAccessor, h ) )
 				{
 					isPrototype = true;
-					writeAccessor->second = convert( samples, times, frameIdx, cyclesAttributes, nodeName );
+					std::vector<IECore::ConstObjectPtr> triangulatedSamples;
+					std::vector<const IECore::Object *> triangulatedSamplesVector;
+					for( size_t i = 0; i < samples.size(); ++i )
+					{
+						IECore::MurmurHash sampleHash = samplesHash;
+						sampleHash.append( (uint64_t)i );
+						triangulatedSamples.push_back( triangulate( samples[i], sampleHash ) );
+						triangulatedSamplesVector.push_back( triangulatedSamples.back().get() );
+					}
+					writeAccessor->second = convert( triangulatedSamplesVector, times, frameIdx, cyclesAttributes, nodeName );
 				}
 				cgeo = writeAccessor->second;
 			}
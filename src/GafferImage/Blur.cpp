@@ -36,19 +36,160 @@
 
 #include "GafferImage/Blur.h"
 
+#include "GafferImage/BufferAlgo.h"
 #include "GafferImage/FilterAlgo.h"
 #include "GafferImage/Resample.h"
+#include "GafferImage/Sampler.h"
 
 #include "Gaffer/StringPlug.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace std;
 using namespace Imath;
+using namespace IECore;
 using namespace Gaffer;
 using namespace GafferImage;
 
 GAFFER_NODE_DEFINE_TYPE( Blur );
 
+namespace
+{
+
 const char *g_blurFilterName = "smoothGaussian";
 
+// Fast mode
+// =========
+//
+// We approximate a gaussian with three passes of a box filter. Each box is
+// computed with a running sum, costing one addition and one subtraction per
+// pixel regardless of its width. To give continuous control over the radius,
+// we use the "extended box" of Gwosdek et al, which adds a fractionally weighted
+// sample at each end of an integer width box, allowing its variance to take any
+// value.
+
+struct BoxFilter
+{
+
+	// Chooses the widest integer box whose variance doesn't exceed
+	// `variance`, and the edge weight that makes up the difference.
+	BoxFilter( double variance )
+	{
+		radius = std::floor( 0.5 * std::sqrt( 12.0 * variance + 1.0 ) - 0.5 );
+		const double r = radius;
+		edgeWeight = ( 2.0 * r + 1.0 ) * ( r * ( r + 1.0 ) / 3.0 - variance ) / ( 2.0 * ( variance - ( r + 1.0 ) * ( r + 1.0 ) ) );
+		edgeWeight = std::clamp( edgeWeight, 0.0, 1.0 );
+		normalisation = 1.0 / ( 2.0 * r + 1.0 + 2.0 * edgeWeight );
+	}
+
+	// The number of input pixels needed on either side of each output pixel.
+	int support() const
+	{
+		return edgeWeight > 0 ? radius + 1 : radius;
+	}
+
+	// Filters `size` pixels from `in`, writing `size - 2 * support()` pixels to `out`.
+	void apply( const float *in, int size, float *out ) const
+	{
+		const int s = support();
+		const int outSize = size - 2 * s;
+		const bool edges = edgeWeight > 0;
+
+		if( !std::all_of( in, in + size, [] ( float v ) { return std::isfinite( v ); } ) )
+		{
+			// Infinities and NaNs would poison the running sum for the
+			// rest of the row, so we fall back to summing each window
+			// separately.
+			for( int i = 0; i < outSize; ++i )
+			{
+				const float *c = in + i + s;
+				double sum = 0;
+				for( int k = -radius; k <= radius; ++k )
+				{
+					sum += c[k];
+				}
+				if( edges )
+				{
+					sum += edgeWeight * ( (double)c[-radius-1] + c[radius+1] );
+				}
+				out[i] = sum * normalisation;
+			}
+			return;
+		}
+
+		// We accumulate in double precision, as the error
+		// in a float sum would grow along the row.
+		double sum = 0;
+		for( int k = s - radius; k <= s + radius; ++k )
+		{
+			sum += in[k];
+		}
+
+		for( int i = 0; i < outSize; ++i )
+		{
+			const float *c = in + i + s;
+			if( edges )
+			{
+				out[i] = ( sum + edgeWeight * ( (double)c[-radius-1] + c[radius+1] ) ) * normalisation;
+			}
+			else
+			{
+				out[i] = sum * normalisation;
+			}
+			if( i + 1 < outSize )
+			{
+				sum += (double)c[radius+1] - c[-radius];
+			}
+		}
+	}
+
+	int radius;
+	double edgeWeight;
+	double normalisation;
+
+};
+
+// The variance of the smoothGaussian filter, relative to the square of
+// its radius.
+const double g_smoothGaussianVariance = 0.0983;
+
+struct BoxCascade
+{
+
+	// The Accurate mode filters with a smoothGaussian of radius `blurRadius + 1`,
+	// and we match its variance, less the variance at `blurRadius == 0` so that
+	// a zero radius leaves the image unchanged in both modes. The variance is
+	// divided equally between the three passes.
+	BoxCascade( float blurRadius )
+		:	box( blurRadius * ( blurRadius + 2.0 ) * g_smoothGaussianVariance / 3.0 )
+	{
+	}
+
+	int support() const
+	{
+		return 3 * box.support();
+	}
+
+	// Filters `values` in place, reducing its size by `2 * support()`.
+	void apply( vector<float> &values, vector<float> &scratch ) const
+	{
+		const int s = box.support();
+		for( int pass = 0; pass < 3; ++pass )
+		{
+			scratch.resize( values.size() - 2 * s );
+			box.apply( values.data(), values.size(), scratch.data() );
+			std::swap( values, scratch );
+		}
+	}
+
+	BoxFilter box;
+
+};
+
+} // namespace
+
 size_t Blur::g_firstPlugIndex = 0;
 
 Blur::Blur( const std::string &name )
@@ -61,6 +202,7 @@ Blur::Blur( const std::string &name )
 	addChild( new V2fPlug( "radius", Plug::In, V2f( 0 ), V2f( 0 ) ) );
 	addChild( resample->boundingModePlug()->createCounterpart( "boundingMode", Plug::In ) );
 	addChild( new BoolPlug( "expandDataWindow" ) );
+	addChild( new IntPlug( "mode", Plug::In, (int)Mode::Accurate, (int)Mode::Accurate, (int)Mode::Fast ) );
 
 	addChild( new V2fPlug( "__filterScale", Plug::Out ) );
 
@@ -69,6 +211,8 @@ Blur::Blur( const std::string &name )
 
 	addChild( resample );
 
+	addChild( new FloatVectorDataPlug( "__horizontalPass", Plug::Out, ImagePlug::blackTile() ) );
+
 	resample->inPlug()->setInput( inPlug() );
 	resample->filterPlug()->setValue( g_blurFilterName );
 	resample->boundingModePlug()->setInput( boundingModePlug() );
@@ -118,44 +262,64 @@ const Gaffer::BoolPlug *Blur::expandDataWindowPlug() const
 	return getChild<BoolPlug>( g_firstPlugIndex + 2 );
 }
 
+Gaffer::IntPlug *Blur::modePlug()
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
+const Gaffer::IntPlug *Blur::modePlug() const
+{
+	return getChild<IntPlug>( g_firstPlugIndex + 3 );
+}
+
 Gaffer::V2fPlug *Blur::filterScalePlug()
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 const Gaffer::V2fPlug *Blur::filterScalePlug() const
 {
-	return getChild<V2fPlug>( g_firstPlugIndex + 3 );
+	return getChild<V2fPlug>( g_firstPlugIndex + 4 );
 }
 
 Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug()
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 const Gaffer::AtomicBox2iPlug *Blur::resampledDataWindowPlug() const
 {
-	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 4 );
+	return getChild<AtomicBox2iPlug>( g_firstPlugIndex + 5 );
 }
 
 Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug()
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
 }
 
 const Gaffer::FloatVectorDataPlug *Blur::resampledChannelDataPlug() const
 {
-	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 5 );
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 6 );
 }
 
 Resample *Blur::resample()
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 7 );
 }
 
 const Resample *Blur::resample() const
 {
-	return getChild<Resample>( g_firstPlugIndex + 6 );
+	return getChild<Resample>( g_firstPlugIndex + 7 );
+}
+
+Gaffer::FloatVectorDataPlug *Blur::horizontalPassPlug()
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 8 );
+}
+
+const Gaffer::FloatVectorDataPlug *Blur::horizontalPassPlug() const
+{
+	return getChild<FloatVectorDataPlug>( g_firstPlugIndex + 8 );
 }
 
 void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
@@ -174,9 +338,35 @@ void Blur::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs )
 		outputs.push_back( filterScalePlug()->getChild<ValuePlug>( input->getName() ) );
 		outputs.push_back( outPlug()->dataWindowPlug() );
 		outputs.push_back( outPlug()->channelDataPlug() );
+		if( input == radiusPlug()->getChild( 0 ) )
+		{
+			outputs.push_back( horizontalPassPlug() );
+		}
+	}
+	else if( input == modePlug() )
+	{
+		outputs.push_back( outPlug()->dataWindowPlug() );
+		outputs.push_back( outPlug()->channelDataPlug() );
+	}
+	else if(
+		input == inPlug()->dataWindowPlug() ||
+		input == inPlug()->channelDataPlug() ||
+		input == boundingModePlug()
+	)
+	{
+		outputs.push_back( horizontalPassPlug() );
+		if( input == inPlug()->dataWindowPlug() )
+		{
+			outputs.push_back( outPlug()->dataWindowPlug() );
+		}
+		if( input != inPlug()->channelDataPlug() )
+		{
+			outputs.push_back( outPlug()->channelDataPlug() );
+		}
 	}
 	else if(
-		input == resampledChannelDataPlug()
+		input == resampledChannelDataPlug() ||
+		input == horizontalPassPlug()
 	)
 	{
 		outputs.push_back( outPlug()->channelDataPlug() );
@@ -191,6 +381,24 @@ void Blur::hash( const ValuePlug *output, const Context *context, IECore::Murmur
 	{
 		radiusPlug()->getChild<ValuePlug>( output->getName() )->hash( h );
 	}
+	else if( output == horizontalPassPlug() )
+	{
+		const BoxCascade cascade( radiusPlug()->getValue().x );
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		const V2i support( cascade.support(), 0 );
+
+		Sampler sampler(
+			inPlug(),
+			context->get<std::string>( ImagePlug::channelNameContextName ),
+			Box2i( tileBound.min - support, tileBound.max + support ),
+			(Sampler::BoundingMode)boundingModePlug()->getValue()
+		);
+		sampler.hash( h );
+		h.append( cascade.box.radius );
+		h.append( cascade.box.edgeWeight );
+		h.append( tileOrigin );
+	}
 }
 
 void Blur::compute( ValuePlug *output, const Context *context ) const
@@ -214,54 +422,237 @@ void Blur::compute( ValuePlug *output, const Context *context ) const
 		);
 		return;
 	}
+	else if( output == horizontalPassPlug() )
+	{
+		// Each row of the tile is filtered independently, from a row of
+		// input extended by the support of the filter on either side.
+
+		const BoxCascade cascade( radiusPlug()->getValue().x );
+		const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+		const Box2i tileBound( tileOrigin, tileOrigin + V2i( ImagePlug::tileSize() ) );
+		const V2i support( cascade.support(), 0 );
+		const Box2i inputBound( tileBound.min - support, tileBound.max + support );
+
+		Sampler sampler(
+			inPlug(),
+			context->get<std::string>( ImagePlug::channelNameContextName ),
+			inputBound,
+			(Sampler::BoundingMode)boundingModePlug()->getValue()
+		);
+
+		FloatVectorDataPtr resultData = new FloatVectorData;
+		vector<float> &result = resultData->writable();
+		result.reserve( ImagePlug::tilePixels() );
+
+		vector<float> row;
+		vector<float> scratch;
+		for( int y = tileBound.min.y; y < tileBound.max.y; ++y )
+		{
+			Canceller::check( context->canceller() );
+
+			row.clear();
+			sampler.visitPixels(
+				Box2i( V2i( inputBound.min.x, y ), V2i( inputBound.max.x, y + 1 ) ),
+				[&row] ( float v, int x, int y )
+				{
+					row.push_back( v );
+				}
+			);
+			cascade.apply( row, scratch );
+			result.insert( result.end(), row.begin(), row.end() );
+		}
+
+		static_cast<FloatVectorDataPlug *>( output )->setValue( resultData );
+		return;
+	}
 
 	FlatImageProcessor::compute( output, context );
 }
 
 void Blur::hashDataWindow( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) && expandDataWindowPlug()->getValue() )
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) || !expandDataWindowPlug()->getValue() )
+	{
+		h = inPlug()->dataWindowPlug()->hash();
+	}
+	else if( (Mode)modePlug()->getValue() == Mode::Accurate )
 	{
 		h = resampledDataWindowPlug()->hash();
 	}
 	else
 	{
-		h = inPlug()->dataWindowPlug()->hash();
+		FlatImageProcessor::hashDataWindow( parent, context, h );
+		inPlug()->dataWindowPlug()->hash( h );
+		h.append( V2i( BoxCascade( radius.x ).support(), BoxCascade( radius.y ).support() ) );
 	}
 }
 
 Imath::Box2i Blur::computeDataWindow( const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) && expandDataWindowPlug()->getValue() )
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) || !expandDataWindowPlug()->getValue() )
+	{
+		return inPlug()->dataWindowPlug()->getValue();
+	}
+	else if( (Mode)modePlug()->getValue() == Mode::Accurate )
 	{
 		return resampledDataWindowPlug()->getValue();
 	}
 	else
 	{
-		return inPlug()->dataWindowPlug()->getValue();
+		const Box2i dataWindow = inPlug()->dataWindowPlug()->getValue();
+		if( BufferAlgo::empty( dataWindow ) )
+		{
+			return dataWindow;
+		}
+		const V2i support( BoxCascade( radius.x ).support(), BoxCascade( radius.y ).support() );
+		return Box2i( dataWindow.min - support, dataWindow.max + support );
 	}
 }
 
 void Blur::hashChannelData( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) )
+	{
+		h = inPlug()->channelDataPlug()->hash();
+		return;
+	}
+	else if( (Mode)modePlug()->getValue() == Mode::Accurate )
 	{
 		h = resampledChannelDataPlug()->hash();
+		return;
 	}
-	else
+
+	Box2i dataWindow;
 	{
-		h = inPlug()->channelDataPlug()->hash();
+		ImagePlug::GlobalScope c( context );
+		dataWindow = inPlug()->dataWindowPlug()->getValue();
+	}
+
+	if( BufferAlgo::empty( dataWindow ) )
+	{
+		h = ImagePlug::blackTile()->Object::hash();
+		return;
 	}
+
+	FlatImageProcessor::hashChannelData( parent, context, h );
+
+	const BoxCascade cascade( radius.y );
+	const V2i tileOrigin = context->get<V2i>( ImagePlug::tileOriginContextName );
+	const Sampler::BoundingMode boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+
+	ImagePlug::ChannelDataScope tileScope( context );
+	V2i passTileOrigin( tileOrigin.x, 0 );
+	tileScope.setTileOrigin( &passTileOrigin );
+
+	int lastTileY = std::numeric_limits<int>::min();
+	for( int y = tileOrigin.y - cascade.support(), eY = tileOrigin.y + ImagePlug::tileSize() + cascade.support(); y < eY; ++y )
+	{
+		const int sourceY = boundingMode == Sampler::Clamp ? std::clamp( y, dataWindow.min.y, dataWindow.max.y - 1 ) : y;
+		if( sourceY < dataWindow.min.y || sourceY >= dataWindow.max.y )
+		{
+			continue;
+		}
+		const int tileY = ImagePlug::tileOrigin( V2i( 0, sourceY ) ).y;
+		if( tileY != lastTileY )
+		{
+			passTileOrigin.y = tileY;
+			horizontalPassPlug()->hash( h );
+			lastTileY = tileY;
+		}
+	}
+
+	h.append( dataWindow.min.y );
+	h.append( dataWindow.max.y );
+	h.append( (int)boundingMode );
+	h.append( cascade.box.radius );
+	h.append( cascade.box.edgeWeight );
+	h.append( tileOrigin );
 }
 
 IECore::ConstFloatVectorDataPtr Blur::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	if( radiusPlug()->getValue() != V2f( 0 ) )
+	const V2f radius = radiusPlug()->getValue();
+	if( radius == V2f( 0 ) )
+	{
+		return inPlug()->channelDataPlug()->getValue();
+	}
+	else if( (Mode)modePlug()->getValue() == Mode::Accurate )
 	{
 		return resampledChannelDataPlug()->getValue();
 	}
-	else
+
+	Box2i dataWindow;
 	{
-		return inPlug()->channelDataPlug()->getValue();
+		ImagePlug::GlobalScope c( context );
+		dataWindow = inPlug()->dataWindowPlug()->getValue();
 	}
+
+	if( BufferAlgo::empty( dataWindow ) )
+	{
+		return ImagePlug::blackTile();
+	}
+
+	// Gather the rows of the horizontal pass needed to filter each column.
+	// Rows outside the data window are black or clamped according to the
+	// bounding mode, in the same way that the Sampler treats pixels in the
+	// horizontal pass.
+
+	const BoxCascade cascade( radius.y );
+	const int tileSize = ImagePlug::tileSize();
+	const int numRows = tileSize + 2 * cascade.support();
+	const Sampler::BoundingMode boundingMode = (Sampler::BoundingMode)boundingModePlug()->getValue();
+
+	vector<const float *> rows( numRows, nullptr );
+	vector<ConstFloatVectorDataPtr> passTiles;
+	{
+		ImagePlug::ChannelDataScope tileScope( context );
+		V2i passTileOrigin( tileOrigin.x, 0 );
+		tileScope.setTileOrigin( &passTileOrigin );
+
+		int lastTileY = std::numeric_limits<int>::min();
+		for( int i = 0; i < numRows; ++i )
+		{
+			const int y = tileOrigin.y - cascade.support() + i;
+			const int sourceY = boundingMode == Sampler::Clamp ? std::clamp( y, dataWindow.min.y, dataWindow.max.y - 1 ) : y;
+			if( sourceY < dataWindow.min.y || sourceY >= dataWindow.max.y )
+			{
+				continue;
+			}
+			const int tileY = ImagePlug::tileOrigin( V2i( 0, sourceY ) ).y;
+			if( tileY != lastTileY )
+			{
+				passTileOrigin.y = tileY;
+				passTiles.push_back( horizontalPassPlug()->getValue() );
+				lastTileY = tileY;
+			}
+			rows[i] = passTiles.back()->readable().data() + ( sourceY - tileY ) * tileSize;
+		}
+	}
+
+	FloatVectorDataPtr resultData = new FloatVectorData;
+	vector<float> &result = resultData->writable();
+	result.resize( ImagePlug::tilePixels() );
+
+	vector<float> column;
+	vector<float> scratch;
+	for( int x = 0; x < tileSize; ++x )
+	{
+		Canceller::check( context->canceller() );
+
+		column.resize( numRows );
+		for( int i = 0; i < numRows; ++i )
+		{
+			column[i] = rows[i] ? rows[i][x] : 0.0f;
+		}
+		cascade.apply( column, scratch );
+		for( int y = 0; y < tileSize; ++y )
+		{
+			result[y * tileSize + x] = column[y];
+		}
+	}
+
+	return resultData;
 }
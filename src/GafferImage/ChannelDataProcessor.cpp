@@ -130,6 +130,11 @@ bool ChannelDataProcessor::channelEnabled( const std::string &channel ) const
 	return IECore::StringAlgo::matchMultiple( channel, channelsPlug()->getValue() );
 }
 
+bool ChannelDataProcessor::acceptsUniformData() const
+{
+	return false;
+}
+
 void ChannelDataProcessor::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hashChannelData( output, context, h );
@@ -169,7 +174,7 @@ void ChannelDataProcessor::hashChannelData( const GafferImage::ImagePlug *output
 
 IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const std::string &channelName, const Imath::V2i &tileOrigin, const Gaffer::Context *context, const ImagePlug *parent ) const
 {
-	IECore::FloatVectorDataPtr outData = inPlug()->channelData( channelName, tileOrigin )->copy();
+	IECore::ConstFloatVectorDataPtr inData = inPlug()->channelData( channelName, tileOrigin );
 
 	IECore::ConstStringVectorDataPtr channelNamesData;
 	bool unpremult = false;
@@ -200,8 +205,32 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 		{
 			postAlphaData = alphaData;
 		}
+	}
+
+	// If the derived class supports it, and the input tile is uniform along
+	// with any alpha tiles needed for unpremultiplication, then we only need
+	// to process a single value.
 
-		int size = alphaData->readable().size();
+	float uniformValue;
+	float uniformAlpha;
+	float uniformPostAlpha;
+	IECore::FloatVectorDataPtr outData;
+	if(
+		acceptsUniformData() &&
+		ImagePlug::isUniformTile( inData.get(), uniformValue ) &&
+		( !alphaData || ( ImagePlug::isUniformTile( alphaData.get(), uniformAlpha ) && ImagePlug::isUniformTile( postAlphaData.get(), uniformPostAlpha ) ) )
+	)
+	{
+		outData = new IECore::FloatVectorData( std::vector<float>( 1, uniformValue ) );
+	}
+	else
+	{
+		outData = inData->copy();
+	}
+
+	if( alphaData )
+	{
+		int size = outData->readable().size();
 		const float *A = &alphaData->readable().front();
 		float *O = &outData->writable().front();
 		for( int j = 0; j < size; j++ )
@@ -216,9 +245,9 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 
 	}
 	processChannelData( context, parent, channelName, outData );
-	if( unpremult && postAlphaData )
+	if( postAlphaData )
 	{
-		int size = postAlphaData->readable().size();
+		int size = outData->readable().size();
 		const float *A = &postAlphaData->readable().front();
 		float *O = &outData->writable().front();
 
@@ -250,5 +279,17 @@ IECore::ConstFloatVectorDataPtr ChannelDataProcessor::computeChannelData( const
 		}
 
 	}
+
+	const size_t inSize = inData->readable().size();
+	if( outData->readable().size() != inSize )
+	{
+		const float value = outData->readable()[0];
+		if( (int)inSize == ImagePlug::tilePixels() )
+		{
+			return ImagePlug::uniformTile( value );
+		}
+		outData->writable().assign( inSize, value );
+	}
+
 	return outData;
 }
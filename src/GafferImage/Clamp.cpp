@@ -259,3 +259,8 @@ void Clamp::processChannelData( const Gaffer::Context *context, const ImagePlug
 
 	}
 }
+
+bool Clamp::acceptsUniformData() const
+{
+	return true;
+}
@@ -243,7 +243,7 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 
 		const string &layerName = context->get<string>( g_layerNameKey );
 
-		FloatVectorDataPtr rgb[3];
+		ConstFloatVectorDataPtr inRGB[3];
 		ConstFloatVectorDataPtr alpha;
 		int samples = -1;
 		{
@@ -262,28 +262,8 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 				if( ImageAlgo::channelExists( channelNames, channelName ) )
 				{
 					channelDataScope.setChannelName( &channelName );
-					rgb[i] = inPlug()->channelDataPlug()->getValue()->copy();
-
-					samples = rgb[i]->readable().size();
-
-					if( unpremult && alpha )
-					{
-						const float *A = &alpha->readable().front();
-						float *C = &rgb[i]->writable().front();
-						for( int j = 0; j < samples; j++ )
-						{
-							if( *A != 0 )
-							{
-								*C /= *A;
-							}
-							A++;
-							C++;
-						}
-					}
-				}
-				else
-				{
-					rgb[i] = nullptr;
+					inRGB[i] = inPlug()->channelDataPlug()->getValue();
+					samples = inRGB[i]->readable().size();
 				}
 				i++;
 			}
@@ -292,46 +272,108 @@ void ColorProcessor::compute( Gaffer::ValuePlug *output, const Gaffer::Context *
 			{
 				throw IECore::Exception( "Cannot evaluate color data plug with no source channels" );
 			}
+		}
+
+		// If the derived class supports it, and all the inputs are uniform,
+		// then the outputs will be too, and we only need to process a single pixel. Missing channels are
+		// treated as black, and are therefore always uniform.
+
+		float uniformValues[3] = { 0.0f, 0.0f, 0.0f };
+		float uniformAlpha;
+		bool uniform = acceptsUniformData() && ( !alpha || ImagePlug::isUniformTile( alpha.get(), uniformAlpha ) );
+		for( int i = 0; i < 3 && uniform; i++ )
+		{
+			uniform = !inRGB[i] || ImagePlug::isUniformTile( inRGB[i].get(), uniformValues[i] );
+		}
 
-			for( int k = 0; k < 3; k++ )
+		FloatVectorDataPtr rgb[3];
+		for( int i = 0; i < 3; i++ )
+		{
+			if( uniform )
 			{
-				if( !rgb[k] )
+				rgb[i] = new FloatVectorData( std::vector<float>( 1, uniformValues[i] ) );
+			}
+			else if( inRGB[i] )
+			{
+				rgb[i] = inRGB[i]->copy();
+			}
+			else
+			{
+				rgb[i] = new FloatVectorData();
+				rgb[i]->writable().resize( samples, 0.0f );
+			}
+		}
+
+		// When processing uniform data we only have one value per channel,
+		// but the alpha is also uniform so we can just use its first value.
+		const int processedSamples = rgb[0]->readable().size();
+
+		if( alpha )
+		{
+			for( int i = 0; i < 3; i++ )
+			{
+				if( !inRGB[i] )
 				{
-					rgb[k] = new FloatVectorData();
-					rgb[k]->writable().resize( samples, 0.0f );
+					continue;
+				}
+				const float *A = &alpha->readable().front();
+				float *C = &rgb[i]->writable().front();
+				for( int j = 0; j < processedSamples; j++ )
+				{
+					if( *A != 0 )
+					{
+						*C /= *A;
+					}
+					A++;
+					C++;
 				}
 			}
-
 		}
 
 		colorProcessorData->colorProcessor( rgb[0].get(), rgb[1].get(), rgb[2].get() );
 
-		if( unpremult && alpha )
+		if( alpha )
 		{
 			for( int i = 0; i < 3; i++ )
 			{
-				if( unpremult && alpha )
+				const float *A = &alpha->readable().front();
+				float *C = &rgb[i]->writable().front();
+				for( int j = 0; j < processedSamples; j++ )
 				{
-					const float *A = &alpha->readable().front();
-					float *C = &rgb[i]->writable().front();
-					for( int j = 0; j < samples; j++ )
+					// Pixels with no alpha aren't touched by either the unpremult or repremult
+					if( *A != 0 )
 					{
-						// Pixels with no alpha aren't touched by either the unpremult or repremult
-						if( *A != 0 )
-						{
-							*C *= *A;
-						}
-						A++;
-						C++;
+						*C *= *A;
 					}
+					A++;
+					C++;
 				}
 			}
 		}
 
 		ObjectVectorPtr result = new ObjectVector();
-		result->members().push_back( rgb[0] );
-		result->members().push_back( rgb[1] );
-		result->members().push_back( rgb[2] );
+		for( int i = 0; i < 3; i++ )
+		{
+			if( processedSamples == samples )
+			{
+				result->members().push_back( rgb[i] );
+			}
+			else if( samples == ImagePlug::tilePixels() )
+			{
+				// Share the tile with everything else using this value.
+				// ObjectVector requires non-const members, but our result
+				// is never modified once stored in the cache.
+				result->members().push_back(
+					boost::const_pointer_cast<FloatVectorData>( ImagePlug::uniformTile( rgb[i]->readable()[0] ) )
+				);
+			}
+			else
+			{
+				const float value = rgb[i]->readable()[0];
+				rgb[i]->writable().assign( samples, value );
+				result->members().push_back( rgb[i] );
+			}
+		}
 
 		static_cast<ObjectPlug *>( output )->setValue( result );
 		return;
@@ -352,6 +394,11 @@ Gaffer::ValuePlug::CachePolicy ColorProcessor::computeCachePolicy( const Gaffer:
 	return ImageProcessor::computeCachePolicy( output );
 }
 
+bool ColorProcessor::acceptsUniformData() const
+{
+	return false;
+}
+
 void ColorProcessor::hashChannelData( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	std::string channels;
@@ -227,6 +227,18 @@ void CopyChannels::compute( Gaffer::ValuePlug *output, const Gaffer::Context *co
 	FlatImageProcessor::compute( output, context );
 }
 
+Gaffer::ValuePlug::CachePolicy CopyChannels::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		// Tiles are passed through from the inputs, apart from those on the
+		// edge of the data window, which are cheap to crop. The reasoning is
+		// the same as for `Shuffle::computeCachePolicy()`.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return FlatImageProcessor::computeCachePolicy( output );
+}
+
 
 void CopyChannels::hashDataWindow( const GafferImage::ImagePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
@@ -48,6 +48,13 @@ using namespace IECore;
 using namespace GafferImage;
 using namespace Gaffer;
 
+namespace
+{
+
+const InternedString g_channelDataCachePartition( "image.channelData" );
+
+} // namespace
+
 GAFFER_NODE_DEFINE_TYPE( ImageNode );
 
 size_t ImageNode::g_firstPlugIndex = 0;
@@ -345,3 +352,16 @@ void ImageNode::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outp
 		}
 	}
 }
+
+IECore::InternedString ImageNode::computeCachePartition( const Gaffer::ValuePlug *output ) const
+{
+	if( auto parent = output->parent<ImagePlug>() )
+	{
+		if( output == parent->channelDataPlug() )
+		{
+			return g_channelDataCachePartition;
+		}
+	}
+
+	return ComputeNode::computeCachePartition( output );
+}
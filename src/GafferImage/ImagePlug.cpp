@@ -45,6 +45,9 @@
 
 #include "Gaffer/Context.h"
 #include "Gaffer/ContextAlgo.h"
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+#include <cstring>
 
 using namespace std;
 using namespace tbb;
@@ -200,6 +203,84 @@ const IECore::FloatVectorData *ImagePlug::blackTile()
 	return g_blackTile.get();
 };
 
+namespace
+{
+
+IECore::ConstFloatVectorDataPtr uniformTileGetter( uint32_t key, size_t &cost, const IECore::Canceller *canceller )
+{
+	float value;
+	std::memcpy( &value, &key, sizeof( value ) );
+	cost = 1;
+	return new IECore::FloatVectorData( std::vector<float>( ImagePlug::tilePixels(), value ) );
+}
+
+// Keyed on the bit pattern of the value, so that -0 and 0 (and
+// different NaNs) get distinct tiles. The limit allows for all
+// the distinct constant colours in a reasonable comp, while
+// capping memory usage at 4Mb.
+using UniformTileCache = IECorePreview::LRUCache<uint32_t, IECore::ConstFloatVectorDataPtr>;
+UniformTileCache &uniformTileCache()
+{
+	static UniformTileCache g_cache( uniformTileGetter, 256 );
+	return g_cache;
+}
+
+uint32_t uniformTileKey( float value )
+{
+	uint32_t key;
+	std::memcpy( &key, &value, sizeof( key ) );
+	return key;
+}
+
+} // namespace
+
+IECore::ConstFloatVectorDataPtr ImagePlug::uniformTile( float value )
+{
+	if( uniformTileKey( value ) == uniformTileKey( 0.0f ) )
+	{
+		return blackTile();
+	}
+	else if( value == 1.0f )
+	{
+		return whiteTile();
+	}
+	return uniformTileCache().get( uniformTileKey( value ) );
+}
+
+bool ImagePlug::isUniformTile( const IECore::FloatVectorData *tile, float &value )
+{
+	const std::vector<float> &v = tile->readable();
+	if( v.empty() )
+	{
+		return false;
+	}
+
+	value = v[0];
+	if( tile == blackTile() || tile == whiteTile() )
+	{
+		return true;
+	}
+
+	// Compare bit patterns rather than values, so that tiles
+	// containing NaNs are handled consistently. Checking the last
+	// element first rejects most non-uniform tiles without touching
+	// the rest of the data.
+	const uint32_t key = uniformTileKey( value );
+	if( uniformTileKey( v.back() ) != key )
+	{
+		return false;
+	}
+
+	for( float x : v )
+	{
+		if( uniformTileKey( x ) != key )
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
 bool ImagePlug::acceptsChild( const GraphComponent *potentialChild ) const
 {
 	if( !ValuePlug::acceptsChild( potentialChild ) )
@@ -452,6 +452,20 @@ void ImageReader::compute( ValuePlug *output, const Context *context ) const
 	}
 }
 
+Gaffer::ValuePlug::CachePolicy ImageReader::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		// Our channel data is always passed through from the internal
+		// network, or is a constant default. It is already cached there,
+		// so caching it again would only double the memory used. The same
+		// applies to the half precision tile storage of the internal
+		// OpenImageIOReader, which caching here would defeat.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageNode::computeCachePolicy( output );
+}
+
 void ImageReader::hashViewNames( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	FrameMaskScope scope( context, this, /* clampBlack = */ true );
@@ -44,6 +44,9 @@
 #include "IECore/BoxOps.h"
 
 #include "fmt/format.h"
+
+#include <cstdint>
+#include <cstring>
 #include <limits>
 
 using namespace std;
@@ -86,15 +89,15 @@ struct OpDivide
 #endif
 	static float operate( float A, float B, float a, float b)
 	{
-		if( A == 0.0f )
-		{
-			// This early out affects the result of 0/0. Setting it to NaN would be more mathematically
-			// precise, but not useful in a compositing context.
-			// Using 0 matches Nuke, and allows us to be consistent with the passthrough when the whole
-			// input is a black tile.
-			return 0.0f;
-		}
-		return A / B;
+		// The special case for zero affects the result of 0/0. Setting it to NaN would be more mathematically
+		// precise, but not useful in a compositing context.
+		// Using 0 matches Nuke, and allows us to be consistent with the passthrough when the whole
+		// input is a black tile. We use selects rather than an early out so that loops using
+		// `operate()` can be vectorised, substituting a divisor of 1 so that the compiler doesn't
+		// need to make the division itself conditional.
+		const bool zero = A == 0.0f;
+		const float q = A / ( zero ? 1.0f : B );
+		return zero ? 0.0f : q;
 	}
 #ifdef _MSC_VER
 #pragma warning( default: 4723 )
@@ -148,16 +151,15 @@ struct OpDifference
 {
 	static float operate( float A, float B, float a, float b)
 	{
-		if( memcmp( &A, &B, 4 ) == 0 )
-		{
-			return 0.0f;
-		}
-		float ret = fabs( A - B );
-		if( std::isnan( ret ) )
-		{
-			ret = std::numeric_limits<float>::infinity();
-		}
-		return ret;
+		// Identical values (including infinities and NaNs) have no difference,
+		// and any other comparison producing NaN is treated as infinitely different.
+		// Written without branches so that it can be vectorised.
+		uint32_t bitsA, bitsB;
+		memcpy( &bitsA, &A, 4 );
+		memcpy( &bitsB, &B, 4 );
+		const float d = fabs( A - B );
+		const float nonZero = std::isnan( d ) ? std::numeric_limits<float>::infinity() : d;
+		return bitsA == bitsB ? 0.0f : nonZero;
 	}
 	static const SingleInputMode onlyA = Operate;
 	static const SingleInputMode onlyB = Operate;
@@ -205,6 +207,71 @@ typename Functor::ReturnType dispatchOperation( Merge::Operation op, Functor &&f
 	}
 }
 
+// Loops for applying an Op to a span of pixels, where either or both inputs are present.
+// These account for almost all the time spent in a Merge, so are kept free of branches
+// and function calls so that the compiler can vectorise them. Each has a separate loop
+// for when we are accumulating into the merge buffers in place (`R == B`), as is the
+// case for all but the first operation in a multi-input Merge. The general loop can't
+// be vectorised then, because the compiler's runtime checks for overlap between the
+// inputs and outputs fail, so it would fall back to scalar code.
+
+template<class Op>
+inline void operateSpan( const float *A, const float *B, const float *a, const float *b, float *R, float *r, int length )
+{
+	if( R == B )
+	{
+		for( int j = 0; j < length; j++ )
+		{
+			const float bj = r[j];
+			R[j] = Op::operate( A[j], R[j], a[j], bj );
+			r[j] = Op::operate( a[j], bj, a[j], bj );
+		}
+	}
+	else
+	{
+		for( int j = 0; j < length; j++ )
+		{
+			R[j] = Op::operate( A[j], B[j], a[j], b[j] );
+			r[j] = Op::operate( a[j], b[j], a[j], b[j] );
+		}
+	}
+}
+
+// Outside the A data window, with 0 substituted for A and a.
+template<class Op>
+inline void operateSpanB( const float *B, const float *b, float *R, float *r, int length )
+{
+	if( R == B )
+	{
+		for( int j = 0; j < length; j++ )
+		{
+			const float bj = r[j];
+			R[j] = Op::operate( 0.0f, R[j], 0.0f, bj );
+			r[j] = Op::operate( 0.0f, bj, 0.0f, bj );
+		}
+	}
+	else
+	{
+		for( int j = 0; j < length; j++ )
+		{
+			R[j] = Op::operate( 0.0f, B[j], 0.0f, b[j] );
+			r[j] = Op::operate( 0.0f, b[j], 0.0f, b[j] );
+		}
+	}
+}
+
+// Outside the B data window, with 0 substituted for B and b. The outputs
+// never overlap A, so only one loop is needed.
+template<class Op>
+inline void operateSpanA( const float *A, const float *a, float *R, float *r, int length )
+{
+	for( int j = 0; j < length; j++ )
+	{
+		R[j] = Op::operate( A[j], 0.0f, a[j], 0.0f );
+		r[j] = Op::operate( a[j], 0.0f, a[j], 0.0f );
+	}
+}
+
 // This somewhat complex function is used only within the implementation of the tileRegion function
 // The interface is a bit weird because performance is potentially critical and it's tied directly
 // to tileRegion.
@@ -381,6 +448,24 @@ struct MergeFunctor
 			return;
 		}
 
+		// If both inputs cover the whole tile with uniform values, we can compute
+		// a single result and return a shared uniform tile, without allocating
+		// any merge buffers.
+		const Box2i fullBound( V2i( 0 ), V2i( ImagePlug::tileSize() ) );
+		float uniformB, uniformAlphaB, uniformA, uniformAlphaA;
+		if(
+			boundA == fullBound && boundB == fullBound &&
+			ImagePlug::isUniformTile( channelDataA.get(), uniformA ) &&
+			ImagePlug::isUniformTile( alphaDataA.get(), uniformAlphaA ) &&
+			ImagePlug::isUniformTile( channelDataB.get(), uniformB ) &&
+			ImagePlug::isUniformTile( alphaDataB.get(), uniformAlphaB )
+		)
+		{
+			channelDataB = ImagePlug::uniformTile( Op::operate( uniformA, uniformB, uniformAlphaA, uniformAlphaB ) );
+			alphaDataB = ImagePlug::uniformTile( Op::operate( uniformAlphaA, uniformAlphaB, uniformAlphaA, uniformAlphaB ) );
+			return;
+		}
+
 		// The base layer (B) with the current result
 		const float *B = &channelDataB->readable().front();
 		const float *b = &alphaDataB->readable().front();
@@ -459,14 +544,10 @@ struct MergeFunctor
 				else
 				{
 					// Outside A dataWindow, so call operator with 0 substituted for A and a
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( 0.0f, *B, 0.0f, *b );
-						*r = Op::operate( 0.0f, *b, 0.0f, *b );
-						++B; ++b;
-						++R; ++r;
-					}
+					operateSpanB<Op>( B, b, R, r, length );
 					A += length; a += length;
+					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else if( region == InsideA )
@@ -484,27 +565,19 @@ struct MergeFunctor
 				else
 				{
 					// Outside B dataWindow, so call operator with 0 substituted for B and b
-					for( int j = 0; j < length; j++ )
-					{
-						*R = Op::operate( *A, 0.0f, *a, 0.0f );
-						*r = Op::operate( *a, 0.0f, *a, 0.0f );
-						++A; ++a;
-						++R; ++r;
-					}
+					operateSpanA<Op>( A, a, R, r, length );
+					A += length; a += length;
 					B += length; b += length;
+					R += length; r += length;
 				}
 			}
 			else
 			{
 				// Within both data windows, this is when we actually need to run the full operate()
-				for( int j = 0; j < length; j++ )
-				{
-					*R = Op::operate( *A, *B, *a, *b );
-					*r = Op::operate( *a, *b, *a, *b );
-					++A; ++a;
-					++B; ++b;
-					++R; ++r;
-				}
+				operateSpan<Op>( A, B, a, b, R, r, length );
+				A += length; a += length;
+				B += length; b += length;
+				R += length; r += length;
 			}
 			i += length;
 		}
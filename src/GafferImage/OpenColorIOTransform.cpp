@@ -230,3 +230,8 @@ ColorProcessor::ColorProcessorFunction OpenColorIOTransform::colorProcessor( con
 		cpuProcessor->apply( image );
 	};
 }
+
+bool OpenColorIOTransform::acceptsUniformData() const
+{
+	return true;
+}
@@ -53,6 +53,7 @@
 #include "IECore/FileSequence.h"
 #include "IECore/FileSequenceFunctions.h"
 #include "IECore/MessageHandler.h"
+#include "IECore/VectorTypedData.h"
 
 #include "OpenImageIO/imagecache.h"
 #include "OpenImageIO/deepdata.h"
@@ -64,6 +65,7 @@
 #include "tbb/parallel_for.h"
 #include "tbb/enumerable_thread_specific.h"
 
+#include <atomic>
 #include <memory>
 
 OIIO_NAMESPACE_USING
@@ -115,6 +117,8 @@ void podVectorResizeUninitialized( std::vector<T> &v, size_t s )
 }
 
 const IECore::InternedString g_tileBatchOriginContextName( "__tileBatchOrigin" );
+
+std::atomic_bool g_halfPrecisionTileStorage( false );
 const IECore::InternedString g_noView( "" );
 
 const std::string g_oiioCompression( "compression" );
@@ -1276,6 +1280,31 @@ class File
 
 			}
 
+			if( !spec.deep && g_halfPrecisionTileStorage )
+			{
+				// Channels stored as half in the file can be stored as half in the tile batch without
+				// any loss of precision, halving the memory used by the tile batch in the cache. They are
+				// converted back to float on demand in `computeChannelData()`.
+				tbb::parallel_for(
+					tbb::blocked_range<int>( 0, tileBatchNumTileChannels ),
+					[&] ( const tbb::blocked_range<int> &range )
+					{
+						for( int i = range.begin(); i < range.end(); i++ )
+						{
+							if( !tileChannelPointers[i] || spec.channelformat( i / tileBatchNumTiles ).basetype != TypeDesc::HALF )
+							{
+								continue;
+							}
+
+							HalfVectorDataPtr halfTile = new HalfVectorData();
+							halfTile->writable().assign( tileChannelPointers[i], tileChannelPointers[i] + ImagePlug::tilePixels() );
+							resultChannels->members()[i] = std::move( halfTile );
+						}
+					},
+					taskGroupContext
+				);
+			}
+
 			ObjectVectorPtr result = new ObjectVector();
 			result->members().resize( 2 );
 			result->members()[0] = resultChannels;
@@ -1759,6 +1788,16 @@ size_t OpenImageIOReader::getOpenFilesLimit()
 	return fileCache()->getMaxCost();
 }
 
+void OpenImageIOReader::setHalfPrecisionTileStorage( bool halfPrecisionTileStorage )
+{
+	g_halfPrecisionTileStorage = halfPrecisionTileStorage;
+}
+
+bool OpenImageIOReader::getHalfPrecisionTileStorage()
+{
+	return g_halfPrecisionTileStorage;
+}
+
 size_t OpenImageIOReader::supportedExtensions( std::vector<std::string> &extensions )
 {
 	std::string attr;
@@ -2235,6 +2274,13 @@ IECore::ConstFloatVectorDataPtr OpenImageIOReader::computeChannelData( const std
 			tileBatch->members()[0]
 	)->members()[ subIndex ];
 
+	if( auto halfTile = IECore::runTimeCast< const HalfVectorData >( curTileChannel.get() ) )
+	{
+		FloatVectorDataPtr result = new FloatVectorData();
+		result->writable().assign( halfTile->readable().begin(), halfTile->readable().end() );
+		return result;
+	}
+
 	return IECore::runTimeCast< const FloatVectorData >( curTileChannel );
 }
 
@@ -211,6 +211,21 @@ void Premultiply::processChannelData( const Gaffer::Context *context, const Imag
 	const std::vector<float> &a = aData->readable();
 	std::vector<float> &out = outData->writable();
 
+	if( out.size() != a.size() )
+	{
+		// ChannelDataProcessor has given us a single value representing
+		// a uniform tile. If the alpha is uniform too we can stay in that
+		// representation, otherwise we must expand to per-pixel values.
+		float alpha;
+		if( !useDeepVisibility && ImagePlug::isUniformTile( aData.get(), alpha ) )
+		{
+			out[0] *= alpha;
+			return;
+		}
+		const float value = out[0];
+		out.assign( a.size(), value );
+	}
+
 	if( !useDeepVisibility )
 	{
 		std::vector<float>::const_iterator aIt = a.begin();
@@ -236,4 +251,9 @@ void Premultiply::processChannelData( const Gaffer::Context *context, const Imag
 	}
 }
 
+bool Premultiply::acceptsUniformData() const
+{
+	return true;
+}
+
 } // namespace GafferImage
@@ -42,6 +42,8 @@
 
 #include <algorithm>
 #include <climits>
+#include <cmath>
+#include <cstdint>
 #include <boost/heap/d_ary_heap.hpp>
 
 using namespace std;
@@ -716,6 +718,261 @@ void processTileIndices( Sampler &sampler, const V2i &radius, const Box2i &tileB
 	}
 }
 
+// Tile-based implementations for large radii
+// ==========================================
+//
+// The buffers above step through the tile one pixel at a time, and do work proportional to
+// the filter diameter for every pixel (sorting a row for Median, or scanning a row and all the
+// rows' results for Erode and Dilate). This is efficient for small radii, but becomes very slow
+// as the radius grows. For large radii we instead load the entire input region for the tile
+// up front, and use algorithms whose per-pixel cost is independent of the filter diameter, or
+// nearly so.
+
+// Loads all the pixels needed for a tile into a row-major buffer, replacing NaNs with
+// `nanValue` to match the handling in the buffers above.
+void sampleRegion( Sampler &sampler, const Box2i &region, float nanValue, vector<float> &values )
+{
+	values.clear();
+	values.reserve( region.size().x * region.size().y );
+	sampler.visitPixels( region,
+		[&values, nanValue] ( float v, int x, int y )
+		{
+			values.push_back( std::isnan( v ) ? nanValue : v );
+		}
+	);
+}
+
+// Erode and Dilate are separable : the minimum over a rectangle is the minimum over each
+// column of the minimums over each row. We compute each 1D pass using the van Herk/Gil-Werman
+// algorithm, which divides the input into blocks the size of the filter, and computes running
+// extremes forwards and backwards within each block. Any window then spans at most two
+// blocks, and its result is the extreme of the backwards extreme from the first block and
+// the forwards extreme from the second, requiring just three comparisons per pixel regardless
+// of the filter size.
+//
+// Computes `out[i] = extreme( in[i] ... in[i + windowSize - 1] )` for `outSize` outputs, where
+// `in` and `out` are accessed with the specified strides.
+template<typename Extreme>
+void vanHerkGilWerman( const float *in, int inStride, float *out, int outStride, int outSize, int windowSize, vector<float> &scratch )
+{
+	const int inSize = outSize + windowSize - 1;
+	scratch.resize( 2 * inSize );
+	float *forwards = scratch.data();
+	float *backwards = forwards + inSize;
+
+	for( int blockStart = 0; blockStart < inSize; blockStart += windowSize )
+	{
+		const int blockEnd = std::min( blockStart + windowSize, inSize );
+
+		forwards[blockStart] = in[blockStart * inStride];
+		for( int i = blockStart + 1; i < blockEnd; ++i )
+		{
+			forwards[i] = Extreme::apply( forwards[i-1], in[i * inStride] );
+		}
+
+		backwards[blockEnd-1] = in[(blockEnd-1) * inStride];
+		for( int i = blockEnd - 2; i >= blockStart; --i )
+		{
+			backwards[i] = Extreme::apply( backwards[i+1], in[i * inStride] );
+		}
+	}
+
+	for( int i = 0; i < outSize; ++i )
+	{
+		out[i * outStride] = Extreme::apply( backwards[i], forwards[i + windowSize - 1] );
+	}
+}
+
+struct MinExtreme
+{
+	static float apply( float a, float b ) { return std::min( a, b ); }
+	// NaNs are ignored by the RankMinBuffer, which is equivalent to treating them as infinity
+	static constexpr float nanValue = std::numeric_limits<float>::infinity();
+};
+
+struct MaxExtreme
+{
+	static float apply( float a, float b ) { return std::max( a, b ); }
+	static constexpr float nanValue = -std::numeric_limits<float>::infinity();
+};
+
+template<typename Extreme>
+void processTileSeparable( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const V2i s = 2 * radius + V2i( 1 );
+	const Box2i region( tileBound.min - radius, tileBound.max + radius );
+	const int tileSize = ImagePlug::tileSize();
+
+	// Horizontal pass, reducing each row of the region to the width of the tile.
+	// We sample one row at a time, so memory usage is modest even for huge radii.
+	vector<float> rows( tileSize * region.size().y );
+	vector<float> rowValues;
+	vector<float> scratch;
+	for( int y = region.min.y; y < region.max.y; ++y )
+	{
+		IECore::Canceller::check( canceller );
+		sampleRegion( sampler, Box2i( V2i( region.min.x, y ), V2i( region.max.x, y + 1 ) ), Extreme::nanValue, rowValues );
+		vanHerkGilWerman<Extreme>( rowValues.data(), 1, &rows[( y - region.min.y ) * tileSize], 1, tileSize, s.x, scratch );
+	}
+
+	// Vertical pass, reducing each column to the height of the tile.
+	for( int x = 0; x < tileSize; ++x )
+	{
+		IECore::Canceller::check( canceller );
+		vanHerkGilWerman<Extreme>( &rows[x], tileSize, &result[x], tileSize, tileSize, s.y, scratch );
+	}
+}
+
+// The median isn't separable, so we use the sliding histogram approach of Perreault and
+// Hebert, "Median Filtering in Constant Time". This maintains a histogram for each column
+// of the region, counting the pixels in the rows covered by the filter. The histogram for
+// the filter is the sum of the histograms for the columns it covers, and can be updated
+// when stepping to the next pixel by adding one column histogram and subtracting another.
+// The median is then found by walking the histogram until we have seen half the pixels.
+//
+// Their algorithm uses one bin per value of an 8 bit image, but we need exact results for
+// floating point data. So we first sort all the pixels in the region, and bin them by their
+// rank in the sorted order instead of by value. Each bin covers a range of consecutive ranks,
+// and walking the histogram identifies the bin containing the median. We then refine the
+// result exactly by stepping through the pixels of that bin in sorted order, counting those
+// that are within the filter.
+//
+// Bins of `sqrt( n )` ranks for a region of `n` pixels balance the cost of updating and
+// walking the histogram against the cost of the refinement, making the cost per pixel
+// proportional to the width of the region rather than to the area of the filter.
+void processTileHistogramMedian( Sampler &sampler, const V2i &radius, const Box2i &tileBound, vector<float> &result, const Canceller *canceller )
+{
+	const V2i s = 2 * radius + V2i( 1 );
+	const Box2i region( tileBound.min - radius, tileBound.max + radius );
+	const V2i regionSize = region.size();
+	const int tileSize = ImagePlug::tileSize();
+
+	vector<float> values;
+	sampleRegion( sampler, region, -infinity, values );
+	const int numPixels = values.size();
+
+	IECore::Canceller::check( canceller );
+
+	vector<std::pair<float, int>> sorted( numPixels );
+	for( int i = 0; i < numPixels; ++i )
+	{
+		sorted[i] = std::make_pair( values[i], i );
+	}
+	std::sort( sorted.begin(), sorted.end() );
+
+	IECore::Canceller::check( canceller );
+
+	// Store the sorted values and their positions in separate arrays,
+	// so that the refinement step only touches the data it needs.
+	const int binSize = std::max( 1, (int)std::sqrt( (float)numPixels ) );
+	const int numBins = ( numPixels + binSize - 1 ) / binSize;
+
+	vector<float> sortedValues( numPixels );
+	vector<std::pair<uint16_t, uint16_t>> sortedPositions( numPixels );
+	vector<int> pixelBins( numPixels );
+	for( int r = 0; r < numPixels; ++r )
+	{
+		const int pixelIndex = sorted[r].second;
+		sortedValues[r] = sorted[r].first;
+		sortedPositions[r] = std::make_pair( pixelIndex % regionSize.x, pixelIndex / regionSize.x );
+		pixelBins[pixelIndex] = r / binSize;
+	}
+
+	// Histograms for each column, initialised to cover the filter rows for
+	// the first row of the tile. We also keep the histogram for the first
+	// pixel in each row of the tile up to date as we update the column
+	// histograms, so that we never need to rebuild it from scratch.
+
+	vector<int> columnHistograms( regionSize.x * numBins, 0 );
+	vector<int> rowStartHistogram( numBins, 0 );
+	for( int y = 0; y < s.y; ++y )
+	{
+		for( int x = 0; x < regionSize.x; ++x )
+		{
+			const int bin = pixelBins[y * regionSize.x + x];
+			columnHistograms[x * numBins + bin]++;
+			if( x < s.x )
+			{
+				rowStartHistogram[bin]++;
+			}
+		}
+	}
+
+	vector<int> histogram( numBins );
+	const int medianIndex = ( s.x * s.y ) / 2;
+	for( int y = 0; y < tileSize; ++y )
+	{
+		IECore::Canceller::check( canceller );
+
+		if( y > 0 )
+		{
+			// Step the column histograms down a row.
+			for( int x = 0; x < regionSize.x; ++x )
+			{
+				const int oldBin = pixelBins[(y - 1) * regionSize.x + x];
+				const int newBin = pixelBins[(y + s.y - 1) * regionSize.x + x];
+				columnHistograms[x * numBins + oldBin]--;
+				columnHistograms[x * numBins + newBin]++;
+				if( x < s.x )
+				{
+					rowStartHistogram[oldBin]--;
+					rowStartHistogram[newBin]++;
+				}
+			}
+		}
+
+		histogram = rowStartHistogram;
+		for( int x = 0; x < tileSize; ++x )
+		{
+			if( x > 0 )
+			{
+				// Step the filter histogram right by a column.
+				const int *added = &columnHistograms[(x + s.x - 1) * numBins];
+				const int *removed = &columnHistograms[(x - 1) * numBins];
+				for( int b = 0; b < numBins; ++b )
+				{
+					histogram[b] += added[b] - removed[b];
+				}
+			}
+
+			// Find the bin containing the median.
+			int bin = 0;
+			int remaining = medianIndex;
+			while( remaining >= histogram[bin] )
+			{
+				remaining -= histogram[bin];
+				bin++;
+			}
+
+			// Refine to find the exact value.
+			const Box2i filterBound( V2i( x, y ), V2i( x + s.x, y + s.y ) );
+			for( int r = bin * binSize; ; ++r )
+			{
+				const int px = sortedPositions[r].first;
+				const int py = sortedPositions[r].second;
+				if( px >= filterBound.min.x && px < filterBound.max.x && py >= filterBound.min.y && py < filterBound.max.y )
+				{
+					if( remaining == 0 )
+					{
+						result[y * tileSize + x] = sortedValues[r];
+						break;
+					}
+					remaining--;
+				}
+			}
+		}
+	}
+}
+
+// Thresholds for switching from the buffers to the tile-based implementations. These were
+// chosen by benchmarking both implementations on noisy images across a range of radii. The
+// median is also limited to a maximum radius, since it must hold the whole input region for
+// the tile in memory, and can't be cancelled while sorting it. Beyond that, we fall back to the
+// buffers.
+const int g_minSeparableRadius = 2;
+const int g_minHistogramMedianRadius = 4;
+const int g_maxHistogramMedianRadius = 256;
+
 } // namespace
 
 void RankFilter::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
@@ -877,16 +1134,38 @@ IECore::ConstFloatVectorDataPtr RankFilter::computeChannelData( const std::strin
 
 	result.resize( ImagePlug::tileSize() * ImagePlug::tileSize() );
 
+	const int maxRadius = std::max( radius.x, radius.y );
 	switch( m_mode )
 	{
 		case MedianRank:
-			processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( maxRadius >= g_minHistogramMedianRadius && maxRadius <= g_maxHistogramMedianRadius )
+			{
+				processTileHistogramMedian( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMedianBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 		case ErodeRank:
-			processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( maxRadius >= g_minSeparableRadius )
+			{
+				processTileSeparable<MinExtreme>( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMinBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 		case DilateRank:
-			processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			if( maxRadius >= g_minSeparableRadius )
+			{
+				processTileSeparable<MaxExtreme>( sampler, radius, tileBound, result, context->canceller() );
+			}
+			else
+			{
+				processTile<RankMaxBuffer>( sampler, radius, tileBound, result, context->canceller() );
+			}
 			break;
 	}
 
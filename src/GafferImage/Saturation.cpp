@@ -90,7 +90,7 @@ ColorProcessor::ColorProcessorFunction Saturation::colorProcessor( const Gaffer:
 		std::vector<float> &g = gData->writable();
 		std::vector<float> &b = bData->writable();
 
-		for( int i = 0; i < ImagePlug::tilePixels(); i++ )
+		for( size_t i = 0, e = r.size(); i < e; i++ )
 		{
 			float lum = r[i] * 0.2126 + g[i] * 0.7152 + b[i] * 0.0722;
 			r[i] = ( r[i] - lum ) * saturation + lum;
@@ -99,3 +99,8 @@ ColorProcessor::ColorProcessorFunction Saturation::colorProcessor( const Gaffer:
 		}
 	};
 }
+
+bool Saturation::acceptsUniformData() const
+{
+	return true;
+}
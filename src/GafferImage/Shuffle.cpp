@@ -211,6 +211,20 @@ void Shuffle::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context
 	return ImageProcessor::compute( output, context );
 }
 
+Gaffer::ValuePlug::CachePolicy Shuffle::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == outPlug()->channelDataPlug() )
+	{
+		// Our channel data is always either passed through from the input or
+		// a constant tile, so caching it would only duplicate data that is
+		// already cached upstream. And where the upstream node deliberately
+		// doesn't cache its channel data, such as an OpenImageIOReader
+		// storing half precision tile batches, caching here would defeat it.
+		return ValuePlug::CachePolicy::Uncached;
+	}
+	return ImageProcessor::computeCachePolicy( output );
+}
+
 void Shuffle::hashChannelNames( const GafferImage::ImagePlug *parent, const Gaffer::Context *context, IECore::MurmurHash &h ) const
 {
 	ImageProcessor::hashChannelNames( parent, context, h );
@@ -174,6 +174,23 @@ void Unpremultiply::processChannelData( const Gaffer::Context *context, const Im
 	const std::vector<float> &a = aData->readable();
 	std::vector<float> &out = outData->writable();
 
+	if( out.size() != a.size() )
+	{
+		// Uniform input tile, represented by a single value.
+		// See Premultiply::processChannelData().
+		float alpha;
+		if( ImagePlug::isUniformTile( aData.get(), alpha ) )
+		{
+			if( alpha != 0.0f )
+			{
+				out[0] /= alpha;
+			}
+			return;
+		}
+		const float value = out[0];
+		out.assign( a.size(), value );
+	}
+
 	std::vector<float>::const_iterator aIt = a.begin();
 	for ( std::vector<float>::iterator outIt = out.begin(), outItEnd = out.end(); outIt != outItEnd; ++outIt, ++aIt )
 	{
@@ -184,4 +201,9 @@ void Unpremultiply::processChannelData( const Gaffer::Context *context, const Im
 	}
 }
 
+bool Unpremultiply::acceptsUniformData() const
+{
+	return true;
+}
+
 } // namespace GafferImage
@@ -221,6 +221,18 @@ IECore::FloatVectorDataPtr whiteTile( bool copy )
 	return copy ? d->copy() : boost::const_pointer_cast<IECore::FloatVectorData>( d );
 }
 
+IECore::FloatVectorDataPtr uniformTile( float value, bool copy )
+{
+	IECore::ConstFloatVectorDataPtr d = ImagePlug::uniformTile( value );
+	return copy ? d->copy() : boost::const_pointer_cast<IECore::FloatVectorData>( d );
+}
+
+bool isUniformTile( const IECore::FloatVectorData *tile )
+{
+	float value;
+	return ImagePlug::isUniformTile( tile, value );
+}
+
 boost::python::list registeredFormats()
 {
 	std::vector<std::string> names;
@@ -351,6 +363,8 @@ void GafferImageModule::bindCore()
 		.def( "emptyTile", &emptyTile, ( arg( "_copy" ) = true ) ).staticmethod( "emptyTile" )
 		.def( "blackTile", &blackTile, ( arg( "_copy" ) = true ) ).staticmethod( "blackTile" )
 		.def( "whiteTile", &whiteTile, ( arg( "_copy" ) = true ) ).staticmethod( "whiteTile" )
+		.def( "uniformTile", &uniformTile, ( arg( "value" ), arg( "_copy" ) = true ) ).staticmethod( "uniformTile" )
+		.def( "isUniformTile", &isUniformTile ).staticmethod( "isUniformTile" )
 	;
 
 	using ImageNodeWrapper = ComputeNodeWrapper<ImageNode>;
@@ -134,6 +134,10 @@ void GafferImageModule::bindIO()
 			.staticmethod( "setOpenFilesLimit" )
 			.def( "getOpenFilesLimit", &OpenImageIOReader::getOpenFilesLimit )
 			.staticmethod( "getOpenFilesLimit" )
+			.def( "setHalfPrecisionTileStorage", &OpenImageIOReader::setHalfPrecisionTileStorage )
+			.staticmethod( "setHalfPrecisionTileStorage" )
+			.def( "getHalfPrecisionTileStorage", &OpenImageIOReader::getHalfPrecisionTileStorage )
+			.staticmethod( "getHalfPrecisionTileStorage" )
 			.def( "supportedExtensions", &supportedExtensions<OpenImageIOReader> )
 			.staticmethod( "supportedExtensions" )
 		;
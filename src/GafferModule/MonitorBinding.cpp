@@ -39,12 +39,14 @@
 #include "MonitorBinding.h"
 
 #include "Gaffer/ContextMonitor.h"
+#include "Gaffer/MemoryMonitor.h"
 #include "Gaffer/Monitor.h"
 #include "Gaffer/MonitorAlgo.h"
 #include "Gaffer/Node.h"
 #include "Gaffer/PerformanceMonitor.h"
 #include "Gaffer/Plug.h"
 #include "Gaffer/ThreadMonitor.h"
+#include "Gaffer/TraceMonitor.h"
 #include "Gaffer/VTuneMonitor.h"
 
 #include "IECorePython/RefCountedBinding.h"
@@ -99,6 +101,14 @@ void setComputeDuration( PerformanceMonitor::Statistics &s, boost::chrono::nanos
 	s.computeDuration = boost::chrono::nanoseconds( v );
 }
 
+std::string memoryMonitorStatisticsRepr( MemoryMonitor::Statistics &s )
+{
+	return fmt::format(
+		"Gaffer.MemoryMonitor.Statistics( computeCount = {}, computeMemory = {}, peakComputeMemory = {}, computeCacheMemory = {}, hashCacheEntries = {} )",
+			s.computeCount, s.computeMemory, s.peakComputeMemory, s.computeCacheMemory, s.hashCacheEntries
+	);
+}
+
 template<typename T>
 dict allStatistics( T &m )
 {
@@ -150,6 +160,18 @@ void annotateWrapper3( Node &root, const ContextMonitor &monitor, bool persisten
 	MonitorAlgo::annotate( root, monitor, persistent );
 }
 
+void annotateWrapper4( Node &root, const MemoryMonitor &monitor, bool persistent )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MonitorAlgo::annotate( root, monitor, persistent );
+}
+
+void annotateWrapper5( Node &root, const MemoryMonitor &monitor, MonitorAlgo::MemoryMetric metric, bool persistent )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MonitorAlgo::annotate( root, monitor, metric, persistent );
+}
+
 void removePerformanceAnnotationsWrapper( Node &root )
 {
 	IECorePython::ScopedGILRelease gilRelease;
@@ -162,6 +184,24 @@ void removeContextAnnotationsWrapper( Node &root )
 	MonitorAlgo::removeContextAnnotations( root );
 }
 
+void removeMemoryAnnotationsWrapper( Node &root )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	MonitorAlgo::removeMemoryAnnotations( root );
+}
+
+std::string memoryMonitorFormatStatisticsWrapper1( const MemoryMonitor &monitor, size_t maxLinesPerMetric )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MonitorAlgo::formatStatistics( monitor, maxLinesPerMetric );
+}
+
+std::string memoryMonitorFormatStatisticsWrapper2( const MemoryMonitor &monitor, MonitorAlgo::MemoryMetric metric, size_t maxLines )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	return MonitorAlgo::formatStatistics( monitor, metric, maxLines );
+}
+
 ThreadMonitor::Ptr threadMonitorConstructor( boost::python::object pythonProcessMask )
 {
 	std::vector<IECore::InternedString> processMask;
@@ -199,6 +239,49 @@ dict threadMonitorCombinedStatisticsWrapper( const ThreadMonitor &monitor )
 	return processesPerThreadToPython( monitor.combinedStatistics() );
 }
 
+TraceMonitor::Ptr traceMonitorConstructor( boost::python::object pythonProcessMask )
+{
+	std::vector<IECore::InternedString> processMask;
+	container_utils::extend_container( processMask, pythonProcessMask );
+	return new TraceMonitor( processMask );
+}
+
+list traceMonitorEventsWrapper( const TraceMonitor &monitor )
+{
+	list result;
+	for( const auto &event : monitor.events() )
+	{
+		result.append( event );
+	}
+	return result;
+}
+
+void traceMonitorWriteChromeTraceWrapper( const TraceMonitor &monitor, const std::string &fileName )
+{
+	IECorePython::ScopedGILRelease gilRelease;
+	monitor.writeChromeTrace( fileName );
+}
+
+PlugPtr traceMonitorEventPlug( const TraceMonitor::Event &event )
+{
+	return boost::const_pointer_cast<Plug>( event.plug );
+}
+
+std::string traceMonitorEventType( const TraceMonitor::Event &event )
+{
+	return event.type.string();
+}
+
+boost::chrono::nanoseconds::rep traceMonitorEventStart( const TraceMonitor::Event &event )
+{
+	return event.start.count();
+}
+
+boost::chrono::nanoseconds::rep traceMonitorEventFinish( const TraceMonitor::Event &event )
+{
+	return event.finish.count();
+}
+
 } // namespace
 
 void GafferModule::bindMonitor()
@@ -221,6 +304,14 @@ void GafferModule::bindMonitor()
 			.value( "HashesPerCompute", HashesPerCompute )
 		;
 
+		enum_<MemoryMetric>( "MemoryMetric" )
+			.value( "Invalid", MemoryMetric::Invalid )
+			.value( "ComputeCacheMemory", MemoryMetric::ComputeCacheMemory )
+			.value( "HashCacheEntries", MemoryMetric::HashCacheEntries )
+			.value( "ComputeMemory", MemoryMetric::ComputeMemory )
+			.value( "PeakComputeMemory", MemoryMetric::PeakComputeMemory )
+		;
+
 		def(
 			"formatStatistics",
 			( std::string (*)( const PerformanceMonitor &, size_t ) )&formatStatistics,
@@ -240,6 +331,25 @@ void GafferModule::bindMonitor()
 			)
 		);
 
+		def(
+			"formatStatistics",
+			&memoryMonitorFormatStatisticsWrapper1,
+			(
+				arg( "monitor" ),
+				arg( "maxLinesPerMetric" ) = 50
+			)
+		);
+
+		def(
+			"formatStatistics",
+			&memoryMonitorFormatStatisticsWrapper2,
+			(
+				arg( "monitor" ),
+				arg( "metric" ),
+				arg( "maxLines" ) = 50
+			)
+		);
+
 		def(
 			"annotate",
 			&annotateWrapper1,
@@ -258,8 +368,21 @@ void GafferModule::bindMonitor()
 			( arg( "node" ), arg( "monitor" ), arg( "persistent" ) = true )
 		);
 
+		def(
+			"annotate",
+			&annotateWrapper4,
+			( arg( "node" ), arg( "monitor" ), arg( "persistent" ) = true )
+		);
+
+		def(
+			"annotate",
+			&annotateWrapper5,
+			( arg( "node" ), arg( "monitor" ), arg( "metric" ), arg( "persistent" ) = true )
+		);
+
 		def( "removePerformanceAnnotations", &removePerformanceAnnotationsWrapper, arg( "root" ) );
 		def( "removeContextAnnotations", &removeContextAnnotationsWrapper, arg( "root" ) );
+		def( "removeMemoryAnnotations", &removeMemoryAnnotationsWrapper, arg( "root" ) );
 	}
 
 	{
@@ -271,7 +394,8 @@ void GafferModule::bindMonitor()
 
 	{
 		scope s = IECorePython::RefCountedClass<PerformanceMonitor, Monitor>( "PerformanceMonitor" )
-			.def( init<>() )
+			.def( init<size_t>( arg( "sampleInterval" ) = 1 ) )
+			.def( "sampleInterval", &PerformanceMonitor::sampleInterval )
 			.def( "allStatistics", &allStatistics<PerformanceMonitor> )
 			.def( "plugStatistics", &PerformanceMonitor::plugStatistics, return_value_policy<copy_const_reference>() )
 			.def( "combinedStatistics", &PerformanceMonitor::combinedStatistics, return_value_policy<copy_const_reference>() )
@@ -315,6 +439,37 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<MemoryMonitor, Monitor>( "MemoryMonitor" )
+			.def( init<>() )
+			.def( "allStatistics", &allStatistics<MemoryMonitor> )
+			.def( "plugStatistics", &MemoryMonitor::plugStatistics, return_value_policy<copy_const_reference>() )
+			.def( "combinedStatistics", &MemoryMonitor::combinedStatistics, return_value_policy<copy_const_reference>() )
+		;
+
+		class_<MemoryMonitor::Statistics>( "Statistics" )
+			.def(
+				init<size_t, size_t, size_t, size_t, size_t>(
+					(
+						arg( "computeCount" ) = 0,
+						arg( "computeMemory" ) = 0,
+						arg( "peakComputeMemory" ) = 0,
+						arg( "computeCacheMemory" ) = 0,
+						arg( "hashCacheEntries" ) = 0
+					)
+				)
+			)
+			.def_readwrite( "computeCount", &MemoryMonitor::Statistics::computeCount )
+			.def_readwrite( "computeMemory", &MemoryMonitor::Statistics::computeMemory )
+			.def_readwrite( "peakComputeMemory", &MemoryMonitor::Statistics::peakComputeMemory )
+			.def_readwrite( "computeCacheMemory", &MemoryMonitor::Statistics::computeCacheMemory )
+			.def_readwrite( "hashCacheEntries", &MemoryMonitor::Statistics::hashCacheEntries )
+			.def( self == self )
+			.def( self != self )
+			.def( "__repr__", &memoryMonitorStatisticsRepr )
+		;
+	}
+
 	{
 		scope s = IECorePython::RefCountedClass<ThreadMonitor, Monitor>( "ThreadMonitor" )
 			.def(
@@ -332,6 +487,31 @@ void GafferModule::bindMonitor()
 		;
 	}
 
+	{
+		scope s = IECorePython::RefCountedClass<TraceMonitor, Monitor>( "TraceMonitor" )
+			.def(
+				"__init__",
+				make_constructor(
+					traceMonitorConstructor, default_call_policies(),
+					arg( "processMask" ) = boost::python::tuple()
+				)
+			)
+			.def( "events", &traceMonitorEventsWrapper )
+			.def( "writeChromeTrace", &traceMonitorWriteChromeTraceWrapper )
+		;
+
+		class_<TraceMonitor::Event>( "Event", no_init )
+			.add_property( "plug", &traceMonitorEventPlug )
+			.add_property( "type", &traceMonitorEventType )
+			.def_readonly( "contextHash", &TraceMonitor::Event::contextHash )
+			.def_readonly( "processId", &TraceMonitor::Event::processId )
+			.def_readonly( "parentId", &TraceMonitor::Event::parentId )
+			.def_readonly( "threadId", &TraceMonitor::Event::threadId )
+			.add_property( "start", &traceMonitorEventStart )
+			.add_property( "finish", &traceMonitorEventFinish )
+		;
+	}
+
 #ifdef GAFFER_VTUNE
 	{
 		scope s = IECorePython::RefCountedClass<VTuneMonitor, Monitor>( "VTuneMonitor" )
@@ -42,6 +42,7 @@
 #include "GafferBindings/ValuePlugBinding.h"
 #include "GafferBindings/PlugBinding.h"
 #include "GafferBindings/Serialisation.h"
+#include "GafferBindings/SignalBinding.h"
 
 #include "Gaffer/ValuePlug.h"
 #include "Gaffer/Node.h"
@@ -73,6 +74,11 @@ void setToDefault( ValuePlug &plug )
 	plug.setToDefault();
 }
 
+std::chrono::nanoseconds::rep computeDuration( const ValuePlug::CacheStatistics &statistics )
+{
+	return statistics.computeDuration.count();
+}
+
 bool isSetToDefault( ValuePlug *plug )
 {
 	// we use a GIL release here to prevent a lock in the case where this triggers a graph
@@ -103,6 +109,22 @@ void hash2( ValuePlug *plug, IECore::MurmurHash &h )
 	plug->hash( h);
 }
 
+void removeCachedValue( const ValuePlug *plug )
+{
+	// Computing the hash may require a graph evaluation.
+	IECorePython::ScopedGILRelease r;
+	plug->removeCachedValue();
+}
+
+boost::python::list cachePartitions()
+{
+	boost::python::list result;
+	for( const auto &partition : ValuePlug::cachePartitions() )
+	{
+		result.append( partition.string() );
+	}
+	return result;
+}
 
 } // namespace
 
@@ -133,6 +155,39 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "cacheMemoryUsage" )
 		.def( "clearCache", &ValuePlug::clearCache )
 		.staticmethod( "clearCache" )
+		.def( "cacheClearedSignal", &ValuePlug::cacheClearedSignal, return_value_policy<reference_existing_object>() )
+		.staticmethod( "cacheClearedSignal" )
+		.def( "removeCachedValue", &removeCachedValue )
+		.def( "setCacheEvictionMode", &ValuePlug::setCacheEvictionMode )
+		.staticmethod( "setCacheEvictionMode" )
+		.def( "getCacheEvictionMode", &ValuePlug::getCacheEvictionMode )
+		.staticmethod( "getCacheEvictionMode" )
+		.def( "cacheStatistics", &ValuePlug::cacheStatistics )
+		.staticmethod( "cacheStatistics" )
+		.def( "resetCacheStatistics", &ValuePlug::resetCacheStatistics )
+		.staticmethod( "resetCacheStatistics" )
+		.def( "cachePartitions", &cachePartitions )
+		.staticmethod( "cachePartitions" )
+		.def( "getCachePartitionMemoryLimit", &ValuePlug::getCachePartitionMemoryLimit )
+		.staticmethod( "getCachePartitionMemoryLimit" )
+		.def( "setCachePartitionMemoryLimit", &ValuePlug::setCachePartitionMemoryLimit )
+		.staticmethod( "setCachePartitionMemoryLimit" )
+		.def( "cachePartitionMemoryUsage", &ValuePlug::cachePartitionMemoryUsage )
+		.staticmethod( "cachePartitionMemoryUsage" )
+		.def( "cachePartitionStatistics", &ValuePlug::cachePartitionStatistics )
+		.staticmethod( "cachePartitionStatistics" )
+		.def( "setDiskCacheDirectory", &ValuePlug::setDiskCacheDirectory )
+		.staticmethod( "setDiskCacheDirectory" )
+		.def( "getDiskCacheDirectory", &ValuePlug::getDiskCacheDirectory )
+		.staticmethod( "getDiskCacheDirectory" )
+		.def( "getDiskCacheSizeLimit", &ValuePlug::getDiskCacheSizeLimit )
+		.staticmethod( "getDiskCacheSizeLimit" )
+		.def( "setDiskCacheSizeLimit", &ValuePlug::setDiskCacheSizeLimit )
+		.staticmethod( "setDiskCacheSizeLimit" )
+		.def( "diskCacheUsage", &ValuePlug::diskCacheUsage )
+		.staticmethod( "diskCacheUsage" )
+		.def( "clearDiskCache", &ValuePlug::clearDiskCache )
+		.staticmethod( "clearDiskCache" )
 		.def( "getHashCacheSizeLimit", &ValuePlug::getHashCacheSizeLimit )
 		.staticmethod( "getHashCacheSizeLimit" )
 		.def( "setHashCacheSizeLimit", &ValuePlug::setHashCacheSizeLimit )
@@ -141,6 +196,10 @@ void GafferModule::bindValuePlug()
 		.staticmethod( "hashCacheTotalUsage" )
 		.def( "clearHashCache", &ValuePlug::clearHashCache, arg( "now" ) = false )
 		.staticmethod( "clearHashCache" )
+		.def( "hashCacheStatistics", &ValuePlug::hashCacheStatistics )
+		.staticmethod( "hashCacheStatistics" )
+		.def( "resetHashCacheStatistics", &ValuePlug::resetHashCacheStatistics )
+		.staticmethod( "resetHashCacheStatistics" )
 		.def( "getHashCacheMode", &ValuePlug::getHashCacheMode )
 		.staticmethod( "getHashCacheMode" )
 		.def( "setHashCacheMode", &ValuePlug::setHashCacheMode )
@@ -149,6 +208,22 @@ void GafferModule::bindValuePlug()
 		.def( "__repr__", &repr )
 	;
 
+	SignalClass<ValuePlug::CacheClearedSignal>( "CacheClearedSignal" );
+
+	class_<ValuePlug::CacheStatistics>( "CacheStatistics" )
+		.def_readonly( "hits", &ValuePlug::CacheStatistics::hits )
+		.def_readonly( "misses", &ValuePlug::CacheStatistics::misses )
+		.def_readonly( "evictions", &ValuePlug::CacheStatistics::evictions )
+		.def_readonly( "evictedCost", &ValuePlug::CacheStatistics::evictedCost )
+		.def_readonly( "contentionWaits", &ValuePlug::CacheStatistics::contentionWaits )
+		.add_property( "computeDuration", &computeDuration )
+	;
+
+	enum_<ValuePlug::CacheEvictionMode>( "CacheEvictionMode" )
+		.value( "LRU", ValuePlug::CacheEvictionMode::LRU )
+		.value( "CostAware", ValuePlug::CacheEvictionMode::CostAware )
+	;
+
 	enum_<ValuePlug::HashCacheMode>( "HashCacheMode" )
 		.value( "Standard", ValuePlug::HashCacheMode::Standard )
 		.value( "Checked", ValuePlug::HashCacheMode::Checked )
@@ -607,10 +607,29 @@ void BranchCreator::hashBound( const ScenePath &path, const Gaffer::Context *con
 			break;
 		case Destination :
 		case Ancestor :
+		{
 			FilteredSceneProcessor::hashBound( path, context, parent, h );
 			inPlug()->boundPlug()->hash( h );
-			outPlug()->childBoundsPlug()->hash( h );
+			vector<InternedString> childNames;
+			if( modifiedChildNames( path, childNames ) )
+			{
+				ScenePlug::PathScope pathScope( context );
+				ScenePath childPath = path; childPath.push_back( InternedString() );
+				for( const auto &childName : childNames )
+				{
+					childPath.back() = childName;
+					pathScope.setPath( &childPath );
+					h.append( childName );
+					outPlug()->boundPlug()->hash( h );
+					outPlug()->transformPlug()->hash( h );
+				}
+			}
+			else
+			{
+				outPlug()->childBoundsPlug()->hash( h );
+			}
 			break;
+		}
 		case NewDestination :
 		case NewAncestor :
 			h = outPlug()->childBoundsPlug()->hash();
@@ -634,7 +653,24 @@ Imath::Box3f BranchCreator::computeBound( const ScenePath &path, const Gaffer::C
 		case Destination :
 		case Ancestor : {
 			Box3f result = inPlug()->boundPlug()->getValue();
-			result.extendBy( outPlug()->childBoundsPlug()->getValue() );
+			vector<InternedString> childNames;
+			if( modifiedChildNames( path, childNames ) )
+			{
+				// The input bound already accounts for all the children we
+				// pass through unchanged, so we only need to visit the others.
+				ScenePlug::PathScope pathScope( context );
+				ScenePath childPath = path; childPath.push_back( InternedString() );
+				for( const auto &childName : childNames )
+				{
+					childPath.back() = childName;
+					pathScope.setPath( &childPath );
+					result.extendBy( transform( outPlug()->boundPlug()->getValue(), outPlug()->transformPlug()->getValue() ) );
+				}
+			}
+			else
+			{
+				result.extendBy( outPlug()->childBoundsPlug()->getValue() );
+			}
 			return result;
 		}
 		case NewDestination :
@@ -1256,6 +1292,42 @@ BranchCreator::LocationType BranchCreator::sourceAndBranchPaths( const ScenePath
 	}
 }
 
+bool BranchCreator::modifiedChildNames( const ScenePath &path, std::vector<IECore::InternedString> &childNames ) const
+{
+	ConstBranchesDataPtr branchesData = branches( Context::current() );
+	const BranchesData::Location *location = branchesData->locationOrAncestor( path );
+	assert( location->depth == path.size() );
+
+	for( const auto &child : location->children )
+	{
+		childNames.push_back( child.first );
+	}
+
+	if( location->sourcePaths )
+	{
+		Private::ConstChildNamesMapPtr mapping = boost::static_pointer_cast<const Private::ChildNamesMap>( mappingPlug()->getValue() );
+		for( const auto &name : mapping->outputChildNames()->readable() )
+		{
+			if( mapping->input( name ).index >= 1 )
+			{
+				childNames.push_back( name );
+			}
+		}
+	}
+
+	// If most children are modified anyway, it is quicker to use
+	// `childBoundsPlug()`, which visits them all in parallel.
+	const size_t numChildren = outPlug()->childNamesPlug()->getValue()->readable().size();
+	if( childNames.size() * 4 > numChildren )
+	{
+		return false;
+	}
+
+	// Sort so that hashes are stable from process to process.
+	std::sort( childNames.begin(), childNames.end(), internedStringValueLess );
+	return true;
+}
+
 IECore::PathMatcher::Result BranchCreator::parentAndBranchPaths( const ScenePath &path, ScenePath &parentPath, ScenePath &branchPath ) const
 {
 	const LocationType locationType = sourceAndBranchPaths( path, parentPath, branchPath );
@@ -36,11 +36,15 @@
 
 #include "GafferScene/Private/IECoreScenePreview/CapturingRenderer.h"
 
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
+
 #include "IECore/MessageHandler.h"
 #include "IECore/SimpleTypedData.h"
 
 #include "fmt/format.h"
 
+#include <unordered_set>
+
 using namespace std;
 using namespace IECore;
 using namespace IECoreScenePreview;
@@ -92,6 +96,24 @@ const CapturingRenderer::CapturedObject *CapturingRenderer::capturedObject( cons
 	return nullptr;
 }
 
+size_t CapturingRenderer::numUniqueObjects() const
+{
+	// Hashing every object as it is captured would add significant overhead
+	// to all renders, so we only do it on demand.
+	std::unordered_set<IECore::MurmurHash> hashes;
+	vector<const Object *> samples;
+	for( const auto &o : m_capturedObjects )
+	{
+		samples.clear();
+		for( const auto &sample : o.second->capturedSamples() )
+		{
+			samples.push_back( sample.get() );
+		}
+		hashes.insert( TranslationCache::samplesHash( samples, o.second->capturedSampleTimes() ) );
+	}
+	return hashes.size();
+}
+
 IECore::InternedString CapturingRenderer::name() const
 {
 	return "Capturing";
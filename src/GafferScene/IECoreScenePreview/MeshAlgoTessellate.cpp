@@ -47,8 +47,10 @@
 #include <opensubdiv/bfr/tessellation.h>
 #include <opensubdiv/far/topologyDescriptor.h>
 
-#include <unordered_map>
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <unordered_map>
 
 #include "fmt/format.h"
 
@@ -586,6 +588,49 @@ struct EdgeOwner
 	bool direction;
 };
 
+// The tessellation rate for each edge of the base mesh. For uniform tessellation `edgeRates` is left
+// empty, and every edge uses `uniformRate`. For adaptive tessellation the rates are stored per edge
+// rather than per face, so that the faces on either side of an edge always agree on how many points
+// to insert along it, and the output stays watertight.
+struct TessellationRates
+{
+	int uniformRate;
+	std::vector<int> edgeRates;
+
+	bool uniform() const
+	{
+		return edgeRates.empty();
+	}
+
+	int edgeRate( OSDF::Index edgeIndex ) const
+	{
+		return edgeRates.empty() ? uniformRate : edgeRates[edgeIndex];
+	}
+};
+
+// Create the tessellation pattern for a face. `faceRatesBuffer` provides temporary storage for the
+// rates of the face's edges when tessellating adaptively.
+OSDB::Tessellation faceTessellation(
+	const OSDB::Parameterization &parameterization, const OSDF::ConstIndexArray &fEdges,
+	const TessellationRates &tessRates, const OSDB::Tessellation::Options &tessOptions,
+	std::vector<int> &faceRatesBuffer
+)
+{
+	if( tessRates.uniform() )
+	{
+		return OSDB::Tessellation( parameterization, tessRates.uniformRate, tessOptions );
+	}
+
+	faceRatesBuffer.resize( fEdges.size() );
+	for( int i = 0; i < fEdges.size(); ++i )
+	{
+		faceRatesBuffer[i] = tessRates.edgeRates[ fEdges[i] ];
+	}
+
+	// With only the edge rates specified, OpenSubdiv infers suitable inner rates from them.
+	return OSDB::Tessellation( parameterization, faceRatesBuffer.size(), faceRatesBuffer.data(), tessOptions );
+}
+
 // Store all the topological information needed to allocate and correctly connect up a primvar. This
 // is gathered on the first parallel pass, then used to allocate the outputs, and then used during the
 // final paralllel pass to put the output data in the right places.
@@ -604,7 +649,7 @@ struct PrimvarTopology
 		m_edgeOwners.resize( m_mesh.GetNumEdges(), { -1, -1, false } );
 	}
 
-	inline void addFace( int faceIndex, const OSDB::Tessellation &tessPattern, const OSDF::ConstIndexArray &fVerts, const OSDF::ConstIndexArray &fEdges, int tessUniformRate )
+	inline void addFace( int faceIndex, const OSDB::Tessellation &tessPattern, const OSDF::ConstIndexArray &fVerts, const OSDF::ConstIndexArray &fEdges, const TessellationRates &tessRates )
 	{
 		OSDF::ConstIndexArray fvarValues;
 		if( m_faceVaryingChannel != -1 )
@@ -669,7 +714,7 @@ struct PrimvarTopology
 			}
 
 			OSDF::Index edgeIndex = fEdges[i];
-			int edgeRate = tessUniformRate;
+			int edgeRate = tessRates.edgeRate( edgeIndex );
 			if( edgeRate > 1 )
 			{
 				int pointsPerEdge = edgeRate - 1;
@@ -786,7 +831,7 @@ template <class T>
 void tessellateVariable(
 	const OSDB::Surface<float> &surface, int faceIndex,
 	const OSDF::ConstIndexArray &fVerts, const OSDF::ConstIndexArray &fEdges,
-	int tessUniformRate, const OSDB::Tessellation &tessPattern, const std::vector< Imath::V2f > &coords,
+	const TessellationRates &tessRates, const OSDB::Tessellation &tessPattern, const std::vector< Imath::V2f > &coords,
 	const PrimvarTopology &primvarTopology,
 	TessellationTempBuffers &buffers,
 	PrimvarSetup &setup,
@@ -907,7 +952,7 @@ void tessellateVariable(
 		boundaryIndex++;
 
 		OSDF::Index edgeIndex = fEdges[i];
-		int edgeRate = tessUniformRate;
+		int edgeRate = tessRates.edgeRate( edgeIndex );
 
 		// Now handle an edge
 
@@ -998,9 +1043,12 @@ void tessellateVariable(
 
 		// If we are writing out quad facets, but the face is irregular, and the tessellation rate is odd,
 		// then OpenSubDiv will write out some quad facets that are actually triangles, labelled with one vert
-		// set to -1. In order to output accurate topology, we need to collapse this list, removing -1s, and
+		// set to -1. The same happens in the transition between differing edge rates when tessellating
+		// adaptively. In order to output accurate topology, we need to collapse this list, removing -1s, and
 		// adjusting the vertex counts of corresponding faces.
-		const bool needsCollapse = tessPattern.GetFacetSize() == 4 && fVerts.size() != 4 && ( tessUniformRate & 1 );
+		const bool needsCollapse = tessPattern.GetFacetSize() == 4 && (
+			!tessRates.uniform() || ( fVerts.size() != 4 && ( tessRates.uniformRate & 1 ) )
+		);
 
 		int *outIndices;
 		if( needsCollapse )
@@ -1065,7 +1113,7 @@ void tessellateVariable(
 void tessellateVariables(
 	const SurfaceFactory &meshSurfaceFactory, const OSDB::Tessellation &tessPattern,
 	int faceIndex, OSDF::ConstIndexArray fVerts, OSDF::ConstIndexArray fEdges,
-	int tessUniformRate, const std::vector<Imath::V2f> &tessCoords,
+	const TessellationRates &tessRates, const std::vector<Imath::V2f> &tessCoords,
 	std::vector<int> &outVerticesPerFace, int faceFacetOffset, int faceFacetVertexOffset,
 	const PrimvarTopology &vertexTopology, const OSDB::Surface<float> &vertexSurface,
 	PrimvarSetup &posPrimvarSetup, std::vector<Imath::V3f> &outNormals,
@@ -1078,7 +1126,7 @@ void tessellateVariables(
 	const int numFacets = tessPattern.GetNumFacets();
 
 	tessellateVariable<Imath::V3f>(
-		vertexSurface, faceIndex, fVerts, fEdges, tessUniformRate, tessPattern, tessCoords,
+		vertexSurface, faceIndex, fVerts, fEdges, tessRates, tessPattern, tessCoords,
 		vertexTopology,
 		buffers,
 		posPrimvarSetup, canceller, faceFacetVertexOffset,
@@ -1094,7 +1142,7 @@ void tessellateVariables(
 				using ElementType = typename std::remove_pointer_t< decltype( typedData ) >::ValueType::value_type;
 
 				tessellateVariable<ElementType>(
-					vertexSurface, faceIndex, fVerts, fEdges, tessUniformRate, tessPattern, tessCoords,
+					vertexSurface, faceIndex, fVerts, fEdges, tessRates, tessPattern, tessCoords,
 					vertexTopology,
 					buffers,
 					setup, canceller, faceFacetVertexOffset
@@ -1125,7 +1173,7 @@ void tessellateVariables(
 			{
 				using ElementType = typename std::remove_pointer_t< decltype( typedData ) >::ValueType::value_type;
 				tessellateVariable<ElementType>(
-					buffers.faceVaryingSurface, faceIndex, fVerts, fEdges, tessUniformRate, tessPattern, tessCoords,
+					buffers.faceVaryingSurface, faceIndex, fVerts, fEdges, tessRates, tessPattern, tessCoords,
 					faceVaryingTopologies[i],
 					buffers,
 					faceVaryingPrimvarSetups[i], canceller, faceFacetVertexOffset
@@ -1136,20 +1184,28 @@ void tessellateVariables(
 }
 
 // When OpenSubdiv outputs quads, it sometimes actually makes a triangle by setting one of the 4 vertex indices
-// of a quad to -1. We can currently predict exactly when this happens using these heuristics.
+// of a quad to -1. For uniform tessellation we can predict exactly when this happens using these heuristics.
 //
-// Once we support adaptive subdivision, this logic gets a lot more complicated, and OpenSubdiv doesn't offer
-// a way to query it without getting the full list of facet vertex indices - we'll probably need to either
-// get the facet vertex indices an extra time during the first pass ( or get them and store them for later reuse ),
-// and manually count how many -1s are in the list.
-int numDegenerateQuadsInTessellation( int tessFacetSize, int nVerts, int tessUniformRate )
+// For adaptive tessellation the logic gets a lot more complicated, and OpenSubdiv doesn't offer a way to
+// query it without getting the full list of facet vertex indices - so we get the facet vertex indices an
+// extra time, and manually count how many -1s are in the list.
+int numDegenerateQuadsInTessellation(
+	const OSDB::Tessellation &tessPattern, int nVerts, const TessellationRates &tessRates,
+	std::vector<int> &facetsBuffer
+)
 {
-	if( tessFacetSize != 4 )
+	if( tessPattern.GetFacetSize() != 4 )
 	{
 		// If we're outputting triangles, then OSD never omits vertices
 		return 0;
 	}
-	else if( nVerts == 4 || !( tessUniformRate & 1 ) )
+	else if( !tessRates.uniform() )
+	{
+		facetsBuffer.resize( tessPattern.GetNumFacets() * 4 );
+		tessPattern.GetFacets( facetsBuffer.data() );
+		return std::count( facetsBuffer.begin(), facetsBuffer.end(), -1 );
+	}
+	else if( nVerts == 4 || !( tessRates.uniformRate & 1 ) )
 	{
 		// If the input face is a quad, or the tessellation rate is uniform and even, then OSD always outputs quads
 		return 0;
@@ -1240,7 +1296,7 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 	const MeshPrimitive &inputMesh, int divisions,
 	bool calculateNormals, IECore::InternedString scheme,
 	IECore::InternedString interpolateBoundary, IECore::InternedString faceVaryingLinearInterpolation,
-	IECore::InternedString triangleSubdivisionRule,
+	IECore::InternedString triangleSubdivisionRule, float maxEdgeLength,
 	const IECore::Canceller *canceller
 )
 {
@@ -1249,8 +1305,6 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		return inputMesh.copy();
 	}
 
-	const int tessUniformRate = divisions + 1;
-
 	if( !scheme.string().size() )
 	{
 		scheme = inputMesh.interpolation();
@@ -1375,8 +1429,38 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 	// figuring out shared vertices.
 	OSDF::TopologyLevel const & baseLevel = refiner->GetLevel(0);
 
-	// If we were doing adaptive tessellation, here would be the place to prepare a list of tessellation rates
-	// per edge that would be referenced below in place of tessUniformRate, to ensure consistency.
+	// Prepare the tessellation rates. In adaptive mode, each edge gets a rate based on its length in the
+	// control cage, using as many divisions as needed to bring the output edges below `maxEdgeLength`, but
+	// never more than the requested number of divisions. The rates are per edge rather than per face, to
+	// ensure consistency between adjacent faces.
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	TessellationRates tessRates;
+	tessRates.uniformRate = divisions + 1;
+	if( maxEdgeLength > 0.0f )
+	{
+		Canceller::check( canceller );
+		tessRates.edgeRates.resize( baseLevel.GetNumEdges() );
+		const PrimitiveVariable::IndexedView<Imath::V3f> positions( posPrimvarSetup.m_var );
+		tbb::parallel_for(
+			tbb::blocked_range<int>( 0, baseLevel.GetNumEdges() ),
+			[&]( const tbb::blocked_range<int> &range )
+			{
+				Canceller::check( canceller );
+				for( int edgeIndex = range.begin(); edgeIndex != range.end(); ++edgeIndex )
+				{
+					const OSDF::ConstIndexArray eVerts = baseLevel.GetEdgeVertices( edgeIndex );
+					const float length = ( positions[ eVerts[1] ] - positions[ eVerts[0] ] ).length();
+					tessRates.edgeRates[edgeIndex] = std::clamp(
+						(int)std::ceil( length / maxEdgeLength ), 1, tessRates.uniformRate
+					);
+				}
+			},
+			tbb::auto_partitioner(),
+			taskGroupContext
+		);
+	}
 
 	const int numFaces = baseLevel.GetNumFaces();
 
@@ -1397,8 +1481,6 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		faceVaryingTopologies.emplace_back( baseLevel, i );
 	}
 
-	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
-
 	// For our first parallel_for, we're just sorting out the topology and counts for everything, so we can
 	// allocate our outputs, and set up the correct offsets to store everything at.
 	//
@@ -1418,6 +1500,8 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		[&]( tbb::blocked_range<int> &range )
 		{
 			OSDB::Surface<float> faceSurface;
+			std::vector<int> faceRatesBuffer;
+			std::vector<int> facetsBuffer;
 
 			for( int faceIndex = range.begin(); faceIndex != range.end(); ++faceIndex )
 			{
@@ -1439,20 +1523,20 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 				OSDF::ConstIndexArray fVerts = baseLevel.GetFaceVertices(faceIndex);
 				OSDF::ConstIndexArray fEdges = baseLevel.GetFaceEdges(faceIndex);
 
-				OSDB::Tessellation tessPattern(
-					faceSurface.GetParameterization(), tessUniformRate, tessOptions
+				OSDB::Tessellation tessPattern = faceTessellation(
+					faceSurface.GetParameterization(), fEdges, tessRates, tessOptions, faceRatesBuffer
 				);
 
 				faceFacetOffsets[ faceIndex ] = tessPattern.GetNumFacets();
 				faceFacetVertexOffsets[ faceIndex ] =
 					tessPattern.GetNumFacets() * tessFacetSize -
-					numDegenerateQuadsInTessellation( tessFacetSize, fVerts.size(), tessUniformRate );
+					numDegenerateQuadsInTessellation( tessPattern, fVerts.size(), tessRates, facetsBuffer );
 
-				vertexTopology.addFace( faceIndex, tessPattern, fVerts, fEdges, tessUniformRate );
+				vertexTopology.addFace( faceIndex, tessPattern, fVerts, fEdges, tessRates );
 
 				for( PrimvarTopology &t : faceVaryingTopologies )
 				{
-					t.addFace( faceIndex, tessPattern, fVerts, fEdges, tessUniformRate );
+					t.addFace( faceIndex, tessPattern, fVerts, fEdges, tessRates );
 				}
 			}
 		},
@@ -1518,6 +1602,7 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 		{
 			OSDB::Surface<float> vertexSurface;
 			std::vector<Imath::V2f> tessCoords;
+			std::vector<int> faceRatesBuffer;
 
 			TessellationTempBuffers tessellationTempBuffers;
 
@@ -1533,18 +1618,21 @@ MeshPrimitivePtr MeshAlgo::tessellateMesh(
 				}
 
 				//
-				// Declare a simple uniform Tessellation for the Parameterization
-				// of this face and identify coordinates of the points to evaluate:
+				// Declare the Tessellation for the Parameterization of this face
+				// and identify coordinates of the points to evaluate:
 				//
-				OSDB::Tessellation tessPattern( vertexSurface.GetParameterization(), tessUniformRate, tessOptions );
+				const OSDF::ConstIndexArray fEdges = baseLevel.GetFaceEdges( faceIndex );
+				OSDB::Tessellation tessPattern = faceTessellation(
+					vertexSurface.GetParameterization(), fEdges, tessRates, tessOptions, faceRatesBuffer
+				);
 
 				tessCoords.resize( tessPattern.GetNumCoords() );
 				tessPattern.GetCoords( (float*)tessCoords.data() );
 
 				tessellateVariables(
 					meshSurfaceFactory, tessPattern,
-					faceIndex, baseLevel.GetFaceVertices( faceIndex ), baseLevel.GetFaceEdges( faceIndex ),
-					tessUniformRate, tessCoords,
+					faceIndex, baseLevel.GetFaceVertices( faceIndex ), fEdges,
+					tessRates, tessCoords,
 					outVerticesPerFace, faceFacetOffsets[faceIndex], faceFacetVertexOffsets[faceIndex],
 					vertexTopology, vertexSurface, posPrimvarSetup, outNormals,
 					vertexPrimvarSetups, uniformPrimvarSetups,
@@ -44,6 +44,7 @@
 #include "IECore/DataAlgo.h"
 #include "IECore/TypeTraits.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <numeric>
 
@@ -108,6 +109,28 @@ constexpr bool supportsVectorTypedData()
 	);
 }
 
+// Elements are copied in blocks of this size in parallel, so that we can make good
+// use of threads even when merging a small number of large primitives.
+const size_t g_parallelGrainSize = 10000;
+
+template<typename F>
+void parallelForElements( size_t num, F &&f )
+{
+	if( num <= g_parallelGrainSize )
+	{
+		f( 0, num );
+		return;
+	}
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, num, g_parallelGrainSize ),
+		[&]( const tbb::blocked_range<size_t> &range )
+		{
+			f( range.begin(), range.end() );
+		}
+	);
+}
+
 Imath::M44f normalTransform( const Imath::M44f &m )
 {
 	Imath::M44f result = m.inverse();
@@ -249,16 +272,31 @@ inline void copyElements( const Data *sourceData, size_t sourceIndex, Data *dest
 				if constexpr( std::is_same_v< DataType, V3fVectorData > )
 				{
 					GeometricData::Interpretation interp = typedSourceData->getInterpretation();
-					transformPrimVarValue(
-						&typedSource[ sourceIndex ], &typedDest[ destIndex ], num, matrix, normalMatrix, interp
+					if( matrix == Imath::M44f() )
+					{
+						// Transforming by the identity has no effect, so we can just copy.
+						interp = GeometricData::None;
+					}
+					parallelForElements(
+						num,
+						[&] ( size_t begin, size_t end ) {
+							transformPrimVarValue(
+								&typedSource[ sourceIndex + begin ], &typedDest[ destIndex + begin ], end - begin, matrix, normalMatrix, interp
+							);
+						}
 					);
 				}
 				else
 				{
-					for( size_t i = 0; i < num; i++ )
-					{
-						typedDest[ destIndex + i ] = typedSource[ sourceIndex + i ];
-					}
+					parallelForElements(
+						num,
+						[&] ( size_t begin, size_t end ) {
+							std::copy(
+								typedSource.begin() + sourceIndex + begin, typedSource.begin() + sourceIndex + end,
+								typedDest.begin() + destIndex + begin
+							);
+						}
+					);
 				}
 			}
 			else
@@ -345,10 +383,33 @@ void copyIndices(
 	if( interpolationMatches( primTypeId, sourceInterp, destInterp ) )
 	{
 		// If the interpolation hasn't changed, we don't need to anything special, just translate
-		// each index.
-		for( size_t j = 0; j < numIndices; j++ )
+		// each index. This is the common case, so we use simple loops without `translateIndex()`,
+		// allowing the compiler to vectorise them.
+		const int offset = dataStart;
+		if( sourceIndices )
 		{
-			*(destIndices++) = translateIndex( j );
+			const int *source = sourceIndices->data();
+			parallelForElements(
+				numIndices,
+				[&] ( size_t begin, size_t end ) {
+					for( size_t j = begin; j < end; j++ )
+					{
+						destIndices[j] = offset + source[j];
+					}
+				}
+			);
+		}
+		else
+		{
+			parallelForElements(
+				numIndices,
+				[&] ( size_t begin, size_t end ) {
+					for( size_t j = begin; j < end; j++ )
+					{
+						destIndices[j] = offset + (int)j;
+					}
+				}
+			);
 		}
 	}
 	else if( sourceInterp == PrimitiveVariable::Constant )
@@ -1191,7 +1252,7 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 		for( unsigned int i = 0; i < primitives.size(); i++ )
 		{
 			countInterpolation[interpolation].push_back( primitives[i].first->variableSize( ((PrimitiveVariable::Interpolation)interpolation) ) );
-			accumInterpolation[interpolation][i] = accum;
+			accumInterpolation[interpolation].push_back( accum );
 			accum += countInterpolation[interpolation].back();
 		}
 		totalInterpolation[interpolation] = accum;
@@ -1207,6 +1268,17 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 	// Allocate storage for the primitives variables
 	//
 
+	// The variables we output, in a form that is quicker to iterate than `varInfos`
+	// and the result variables map.
+	struct OutputVariable
+	{
+		const IECore::InternedString *name;
+		const PrimVarInfo *varInfo;
+		PrimitiveVariable *destVar;
+		size_t dataSize;
+	};
+	std::vector<OutputVariable> outputVariables;
+
 	for( auto &[name, varInfo] : varInfos )
 	{
 		if( varInfo.interpolation == PrimitiveVariable::Invalid )
@@ -1228,31 +1300,48 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 
 		IECore::setGeometricInterpretation( p.data.get(), varInfo.interpretation );
 		p.interpolation = varInfo.interpolation;
-		Canceller::check( canceller );
-		dataResize( p.data.get(), accumDataSize );
 
 		if( varInfo.indexed )
 		{
 			p.indices = new IntVectorData();
-			Canceller::check( canceller );
-			p.indices->writable().resize( totalInterpolation[ varInfo.interpolation ] );
 		}
+
+		outputVariables.push_back( { &name, &varInfo, &p, accumDataSize } );
 	}
 
+	// Resizing zero-initializes the data, which is a significant part of the cost of merging,
+	// so we resize the variables in parallel.
+
+	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+
+	tbb::parallel_for(
+		tbb::blocked_range<size_t>( 0, outputVariables.size(), 1 ),
+		[&]( tbb::blocked_range<size_t> &range )
+		{
+			for( size_t i = range.begin(); i != range.end(); i++ )
+			{
+				const OutputVariable &v = outputVariables[i];
+				Canceller::check( canceller );
+				dataResize( v.destVar->data.get(), v.dataSize );
+				if( v.destVar->indices )
+				{
+					Canceller::check( canceller );
+					v.destVar->indices->writable().resize( totalInterpolation[ v.varInfo->interpolation ] );
+				}
+			}
+		},
+		tbb::auto_partitioner(),
+		taskGroupContext
+	);
+
 	//
 	// Now a big parallel loop where we do the majority of actual work - copying all the primvar and topology
 	// data to the destination.
 	//
 
-	// In theory, we would a finer-grained threading of this, so we could optimize the case where a small
-	// number of extremely large primitives are combined. However, with the current level of multithreading,
-	// it's already hard to produce cases where this loop is a significant contributor to runtime cost. The
-	// more significant issue is that when allocating *VectorData, we currently don't have a way to skip
-	// the zero-initialize, so much of the cost is currently in that ( which is hard to parallelize, and
-	// also is completely unnecessary ). There's probably not much point threading this further until we fix
-	// that.
-
-	tbb::task_group_context taskGroupContext( tbb::task_group_context::isolated );
+	// We thread over the primitives here, and `copyElements()` and `copyIndices()` also thread over the
+	// elements of large primitives, so that we make good use of threads when merging a small number of
+	// large primitives.
 
 	tbb::parallel_for(
 		tbb::blocked_range<size_t>( 0, primitives.size() ),
@@ -1263,18 +1352,15 @@ IECoreScene::PrimitivePtr mergePrimitivesInternal(
 				const Primitive &sourcePrim = *primitives[i].first;
 
 				const Imath::M44f &matrix = primitives[i].second;
-				const Imath::M44f normalMatrix = normalTransform( matrix );
+				const Imath::M44f normalMatrix = matrix == Imath::M44f() ? matrix : normalTransform( matrix );
 
 				// Copy the data ( and indices ) for each prim var for this primitive into
 				// the destination primvar.
-				for( auto &[name, varInfo] : varInfos )
+				for( const OutputVariable &outputVariable : outputVariables )
 				{
-					if( varInfo.interpolation == PrimitiveVariable::Invalid )
-					{
-						continue;
-					}
-
-					PrimitiveVariable &destVar = result.result->variables.find( name )->second;
+					const IECore::InternedString &name = *outputVariable.name;
+					const PrimVarInfo &varInfo = *outputVariable.varInfo;
+					PrimitiveVariable &destVar = *outputVariable.destVar;
 
 					const size_t numIndices = countInterpolation[ varInfo.interpolation ][i];
 					const size_t startIndex = accumInterpolation[ varInfo.interpolation ][i];
@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////
+//
+//  Copyright (c) 2024, Cinesite VFX Ltd. All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions are
+//  met:
+//
+//      * Redistributions of source code must retain the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer.
+//
+//      * Redistributions in binary form must reproduce the above
+//        copyright notice, this list of conditions and the following
+//        disclaimer in the documentation and/or other materials provided with
+//        the distribution.
+//
+//      * Neither the name of John Haddon nor the names of
+//        any other contributors to this software may be used to endorse or
+//        promote products derived from this software without specific prior
+//        written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS
+//  IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+//  THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+//  PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+//  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+//  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+//  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+//  PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+//  LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+//  NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+//  SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
+
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
+using namespace IECore;
+using namespace IECoreScenePreview;
+
+namespace
+{
+
+struct CacheGetterKey
+{
+
+	CacheGetterKey()
+		:	translator( nullptr )
+	{
+	}
+
+	CacheGetterKey( const MurmurHash &hash, const TranslationCache::Translator &translator )
+		:	hash( hash ), translator( &translator )
+	{
+	}
+
+	operator const MurmurHash & () const
+	{
+		return hash;
+	}
+
+	MurmurHash hash;
+	const TranslationCache::Translator *translator;
+
+};
+
+ConstObjectPtr cacheGetter( const CacheGetterKey &key, size_t &cost, const IECore::Canceller *canceller )
+{
+	ConstObjectPtr result = (*key.translator)();
+	cost = result ? result->memoryUsage() : 0;
+	return result;
+}
+
+using Cache = IECorePreview::LRUCache<MurmurHash, ConstObjectPtr, IECorePreview::LRUCachePolicy::Parallel, CacheGetterKey>;
+
+Cache &cache()
+{
+	// Cost is in bytes.
+	static Cache g_cache( cacheGetter, 1024 * 1024 * 500 );
+	return g_cache;
+}
+
+} // namespace
+
+ConstObjectPtr TranslationCache::get( const MurmurHash &key, const Translator &translator )
+{
+	return cache().get( CacheGetterKey( key, translator ) );
+}
+
+MurmurHash TranslationCache::samplesHash( const std::vector<const Object *> &samples, const std::vector<float> &times )
+{
+	MurmurHash result;
+	for( const auto &sample : samples )
+	{
+		sample->hash( result );
+	}
+	for( const auto &time : times )
+	{
+		result.append( time );
+	}
+	return result;
+}
+
+void TranslationCache::setMemoryLimit( size_t bytes )
+{
+	cache().setMaxCost( bytes );
+}
+
+size_t TranslationCache::getMemoryLimit()
+{
+	return cache().getMaxCost();
+}
+
+size_t TranslationCache::memoryUsage()
+{
+	return cache().currentCost();
+}
+
+void TranslationCache::clear()
+{
+	cache().clear();
+}
+
+TranslationCache::Statistics TranslationCache::statistics()
+{
+	const Cache::Statistics cacheStatistics = cache().statistics();
+	Statistics result;
+	result.hits = cacheStatistics.hits;
+	result.misses = cacheStatistics.misses;
+	return result;
+}
+
+void TranslationCache::resetStatistics()
+{
+	cache().resetStatistics();
+}
@@ -63,6 +63,7 @@ MeshTessellate::MeshTessellate( const std::string &name )
 	addChild( new StringPlug( "interpolateBoundary", Plug::In, "" ) );
 	addChild( new StringPlug( "faceVaryingLinearInterpolation", Plug::In, "" ) );
 	addChild( new StringPlug( "triangleSubdivisionRule", Plug::In, "" ) );
+	addChild( new FloatPlug( "maxEdgeLength", Plug::In, 0.0f, 0.0f ) );
 
 }
 
@@ -140,6 +141,16 @@ const Gaffer::StringPlug *MeshTessellate::triangleSubdivisionRulePlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 6 );
 }
 
+Gaffer::FloatPlug *MeshTessellate::maxEdgeLengthPlug()
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 7 );
+}
+
+const Gaffer::FloatPlug *MeshTessellate::maxEdgeLengthPlug() const
+{
+	return getChild<FloatPlug>( g_firstPlugIndex + 7 );
+}
+
 bool MeshTessellate::affectsProcessedObject( const Gaffer::Plug *input ) const
 {
 	return
@@ -150,7 +161,8 @@ bool MeshTessellate::affectsProcessedObject( const Gaffer::Plug *input ) const
 		input == tessellatePolygonsPlug() ||
 		input == interpolateBoundaryPlug() ||
 		input == faceVaryingLinearInterpolationPlug() ||
-		input == triangleSubdivisionRulePlug();
+		input == triangleSubdivisionRulePlug() ||
+		input == maxEdgeLengthPlug();
 }
 
 
@@ -166,6 +178,7 @@ void MeshTessellate::hashProcessedObject( const ScenePath &path, const Gaffer::C
 	interpolateBoundaryPlug()->hash( h );
 	faceVaryingLinearInterpolationPlug()->hash( h );
 	triangleSubdivisionRulePlug()->hash( h );
+	maxEdgeLengthPlug()->hash( h );
 }
 
 
@@ -197,6 +210,7 @@ IECore::ConstObjectPtr MeshTessellate::computeProcessedObject( const ScenePath &
 		interpolateBoundaryPlug()->getValue(),
 		faceVaryingLinearInterpolationPlug()->getValue(),
 		triangleSubdivisionRulePlug()->getValue(),
+		maxEdgeLengthPlug()->getValue(),
 		context->canceller()
 	);
 }
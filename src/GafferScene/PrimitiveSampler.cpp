@@ -42,6 +42,8 @@
 #include "IECoreScene/MeshPrimitive.h"
 #include "IECoreScene/PrimitiveEvaluator.h"
 
+#include "IECore/NullObject.h"
+
 #include "tbb/parallel_for.h"
 
 using namespace std;
@@ -61,6 +63,78 @@ namespace
 
 using OutputVariableFunction = std::function<void ( size_t, const PrimitiveEvaluator::Result & )>;
 
+// Wraps a PrimitiveEvaluator so that it can be stored in the compute cache.
+// Evaluators can be neither copied nor serialised, so attempts to do either
+// throw. In particular, this prevents them being written to the disk cache.
+class EvaluatorData : public Data
+{
+
+	public :
+
+		EvaluatorData( const PrimitiveEvaluatorPtr &evaluator = nullptr )
+			:	m_evaluator( evaluator )
+		{
+		}
+
+		IE_CORE_DECLAREEXTENSIONOBJECT( EvaluatorData, GafferScene::PrimitiveSamplerEvaluatorDataTypeId, IECore::Data );
+
+		const PrimitiveEvaluator *evaluator() const
+		{
+			return m_evaluator.get();
+		}
+
+	private :
+
+		PrimitiveEvaluatorPtr m_evaluator;
+
+};
+
+IE_CORE_DEFINEOBJECTTYPEDESCRIPTION( EvaluatorData );
+
+bool EvaluatorData::isEqualTo( const Object *other ) const
+{
+	return Data::isEqualTo( other ) && static_cast<const EvaluatorData *>( other )->m_evaluator == m_evaluator;
+}
+
+void EvaluatorData::hash( MurmurHash &h ) const
+{
+	Data::hash( h );
+	if( m_evaluator )
+	{
+		m_evaluator->primitive()->hash( h );
+	}
+}
+
+void EvaluatorData::copyFrom( const Object *other, CopyContext *context )
+{
+	throw IECore::Exception( "EvaluatorData does not support copying" );
+}
+
+void EvaluatorData::save( SaveContext *context ) const
+{
+	throw IECore::Exception( "EvaluatorData does not support saving" );
+}
+
+void EvaluatorData::load( LoadContextPtr context )
+{
+	throw IECore::Exception( "EvaluatorData does not support loading" );
+}
+
+void EvaluatorData::memoryUsage( Object::MemoryAccumulator &accumulator ) const
+{
+	Data::memoryUsage( accumulator );
+	if( m_evaluator )
+	{
+		// The evaluator holds a reference to the primitive it evaluates, and
+		// its acceleration structures are of comparable size.
+		ConstPrimitivePtr primitive = m_evaluator->primitive();
+		accumulator.accumulate( primitive.get() );
+		accumulator.accumulate( m_evaluator.get(), primitive->memoryUsage() );
+	}
+}
+
+IE_CORE_DECLAREPTR( EvaluatorData )
+
 M44f matrix( const M44f &transform, GeometricData::Interpretation interpretation )
 {
 	switch( interpretation )
@@ -169,6 +243,7 @@ PrimitiveSampler::PrimitiveSampler( const std::string &name )
 	addChild( new StringPlug( "primitiveVariables" ) );
 	addChild( new StringPlug( "prefix" ) );
 	addChild( new StringPlug( "status" ) );
+	addChild( new ObjectPlug( "__sourceEvaluator", Plug::Out, NullObject::defaultNullObject() ) );
 }
 
 PrimitiveSampler::~PrimitiveSampler()
@@ -225,6 +300,82 @@ const Gaffer::StringPlug *PrimitiveSampler::statusPlug() const
 	return getChild<StringPlug>( g_firstPlugIndex + 4 );
 }
 
+Gaffer::ObjectPlug *PrimitiveSampler::sourceEvaluatorPlug()
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 5 );
+}
+
+const Gaffer::ObjectPlug *PrimitiveSampler::sourceEvaluatorPlug() const
+{
+	return getChild<ObjectPlug>( g_firstPlugIndex + 5 );
+}
+
+void PrimitiveSampler::affects( const Gaffer::Plug *input, AffectedPlugsContainer &outputs ) const
+{
+	Deformer::affects( input, outputs );
+
+	if( input == sourceLocationPlug() || input == sourcePlug()->objectPlug() )
+	{
+		outputs.push_back( sourceEvaluatorPlug() );
+	}
+}
+
+void PrimitiveSampler::hash( const Gaffer::ValuePlug *output, const Gaffer::Context *context, IECore::MurmurHash &h ) const
+{
+	if( output == sourceEvaluatorPlug() )
+	{
+		// We deliberately don't call the base class, so that the hash depends only
+		// on the source object, and the evaluator can be shared between all nodes
+		// and contexts that sample the same object.
+		ScenePlug::ScenePath sourcePath;
+		ScenePlug::stringToPath( sourceLocationPlug()->getValue(), sourcePath );
+		h = sourcePlug()->objectHash( sourcePath );
+		h.append( "PrimitiveSampler:sourceEvaluator" );
+		return;
+	}
+
+	Deformer::hash( output, context, h );
+}
+
+void PrimitiveSampler::compute( Gaffer::ValuePlug *output, const Gaffer::Context *context ) const
+{
+	if( output == sourceEvaluatorPlug() )
+	{
+		ScenePlug::ScenePath sourcePath;
+		ScenePlug::stringToPath( sourceLocationPlug()->getValue(), sourcePath );
+		ConstObjectPtr sourceObject = sourcePlug()->object( sourcePath );
+
+		PrimitiveEvaluatorPtr evaluator;
+		if( auto mesh = runTimeCast<const MeshPrimitive>( sourceObject.get() ) )
+		{
+			evaluator = PrimitiveEvaluator::create( MeshAlgo::triangulate( mesh, context->canceller() ) );
+		}
+		else if( auto primitive = runTimeCast<const Primitive>( sourceObject.get() ) )
+		{
+			evaluator = PrimitiveEvaluator::create( primitive );
+		}
+
+		static_cast<ObjectPlug *>( output )->setValue(
+			evaluator ? ConstObjectPtr( new EvaluatorData( evaluator ) ) : NullObject::defaultNullObject()
+		);
+		return;
+	}
+
+	Deformer::compute( output, context );
+}
+
+Gaffer::ValuePlug::CachePolicy PrimitiveSampler::computeCachePolicy( const Gaffer::ValuePlug *output ) const
+{
+	if( output == sourceEvaluatorPlug() )
+	{
+		// Building an evaluator can be expensive, so we want any other threads that
+		// need it to wait for a single build rather than duplicating the work.
+		return ValuePlug::CachePolicy::TaskCollaboration;
+	}
+
+	return Deformer::computeCachePolicy( output );
+}
+
 bool PrimitiveSampler::affectsProcessedObject( const Gaffer::Plug *input ) const
 {
 	return
@@ -235,6 +386,7 @@ bool PrimitiveSampler::affectsProcessedObject( const Gaffer::Plug *input ) const
 		input == statusPlug() ||
 		input == sourcePlug()->existsPlug() ||
 		input == sourcePlug()->objectPlug() ||
+		input == sourceEvaluatorPlug() ||
 		input == inPlug()->transformPlug() ||
 		input == sourcePlug()->transformPlug() ||
 		affectsSamplingFunction( input )
@@ -299,23 +451,14 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 		return inputObject;
 	}
 
-	ConstObjectPtr sourceObject = sourcePlug()->object( sourcePath );
-	const Primitive *sourcePrimitive = runTimeCast<const Primitive>( sourceObject.get() );
-	if( !sourcePrimitive )
+	ConstObjectPtr evaluatorData = sourceEvaluatorPlug()->getValue();
+	if( evaluatorData->isInstanceOf( NullObject::staticTypeId() ) )
 	{
 		return inputObject;
 	}
 
-	ConstPrimitivePtr preprocessedSourcePrimitive = sourcePrimitive;
-	if( auto mesh = runTimeCast<const MeshPrimitive>( preprocessedSourcePrimitive.get() ) )
-	{
-		preprocessedSourcePrimitive = MeshAlgo::triangulate( mesh, context->canceller() );
-	}
-	PrimitiveEvaluatorPtr evaluator = PrimitiveEvaluator::create( preprocessedSourcePrimitive );
-	if( !evaluator )
-	{
-		return inputObject;
-	}
+	const PrimitiveEvaluator *evaluator = static_cast<const EvaluatorData *>( evaluatorData.get() )->evaluator();
+	ConstPrimitivePtr preprocessedSourcePrimitive = evaluator->primitive();
 
 	PrimitivePtr outputPrimitive = inputPrimitive->copy();
 	const size_t size = outputPrimitive->variableSize( outputInterpolation );
@@ -348,6 +491,7 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 	}
 
 	const M44f samplingTransform = transform * sourceTransform.inverse();
+	vector<bool> *statusValues = statusData ? &statusData->writable() : nullptr;
 
 	auto rangeSampler = [&]( const blocked_range<size_t> &r ) {
 		PrimitiveEvaluator::ResultPtr evaluatorResult = evaluator->createResult();
@@ -360,9 +504,9 @@ IECore::ConstObjectPtr PrimitiveSampler::computeProcessedObject( const ScenePath
 				{
 					o( i, *evaluatorResult );
 				}
-				if( statusData )
+				if( statusValues )
 				{
-					statusData->writable()[i] = true;
+					(*statusValues)[i] = true;
 				}
 			}
 		}
@@ -38,6 +38,7 @@
 
 #include "GafferScene/OptionQuery.h"
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
 #include "GafferScene/Private/RendererAlgo.h"
 #include "GafferScene/SceneAlgo.h"
 #include "GafferScene/SceneNode.h"
@@ -342,6 +343,16 @@ void Render::executeInternal( bool flushCaches ) const
 	}
 	Monitor::Scope performanceMonitorScope( performanceMonitor );
 
+	// In the `execute` and `dispatch` applications we know that we're not
+	// executing concurrently with anything else, and that the scene won't be
+	// needed again once it has been given to the renderer.
+	bool batchApplication = false;
+	if( flushCaches )
+	{
+		auto *application = ancestor<ApplicationRoot>();
+		batchApplication = application && ( application->getName() == "execute" || application->getName() == "dispatch" );
+	}
+
 	GafferScene::Private::RendererAlgo::outputOptions( renderOptions.globals.get(), renderer.get() );
 	GafferScene::Private::RendererAlgo::outputOutputs( inPlug(), renderOptions.globals.get(), renderer.get() );
 
@@ -355,7 +366,10 @@ void Render::executeInternal( bool flushCaches ) const
 		GafferScene::Private::RendererAlgo::outputLights( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
 		GafferScene::Private::RendererAlgo::outputLightFilters( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
 		lightLinks.outputLightFilterLinks( adaptedInPlug() );
-		GafferScene::Private::RendererAlgo::outputObjects( adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get() );
+		GafferScene::Private::RendererAlgo::outputObjects(
+			adaptedInPlug(), renderOptions, renderSets, &lightLinks, renderer.get(),
+			/* root = */ ScenePlug::ScenePath(), /* releaseObjects = */ batchApplication
+		);
 	}
 
 	if( renderScope.sceneTranslationOnly() )
@@ -363,7 +377,7 @@ void Render::executeInternal( bool flushCaches ) const
 		return;
 	}
 
-	if( flushCaches )
+	if( batchApplication )
 	{
 		// Now we have generated the scene, flush Cortex and Gaffer caches to
 		// provide more memory to the renderer. We limit this to the `execute`
@@ -374,13 +388,10 @@ void Render::executeInternal( bool flushCaches ) const
 		// - In `execute` and `dispatch` we know we're not executing concurrently
 		//   with anything else, and can therefore pass `now = true` to
 		//   `clearHashCache()` safely.
-		auto *application = ancestor<ApplicationRoot>();
-		if( application && ( application->getName() == "execute" || application->getName() == "dispatch" ) )
-		{
-			ObjectPool::defaultObjectPool()->clear();
-			ValuePlug::clearCache();
-			ValuePlug::clearHashCache( /* now = */ true );
-		}
+		ObjectPool::defaultObjectPool()->clear();
+		IECoreScenePreview::TranslationCache::clear();
+		ValuePlug::clearCache();
+		ValuePlug::clearHashCache( /* now = */ true );
 	}
 
 	renderer->render();
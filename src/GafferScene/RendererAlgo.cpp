@@ -875,7 +875,14 @@ void LightLinks::setsDirtied()
 	{
 		f.second.filteredLightsDirty = true;
 	}
-	clearLightLinks();
+	// Rather than clearing the light links, we mark them as dirty so that
+	// `linkedLights()` can compare the new results with the old ones. This
+	// allows `outputLightLinks()` to skip objects whose links are unchanged,
+	// which is the common case when editing a set in a large scene.
+	for( auto &l : m_lightLinks )
+	{
+		l.second.dirty = true;
+	}
 	m_lightLinksDirty = true;
 	m_lightFilterLinksDirty = true;
 }
@@ -892,6 +899,10 @@ bool LightLinks::lightFilterLinksDirty() const
 
 void LightLinks::clean()
 {
+	for( auto &l : m_lightLinks )
+	{
+		l.second.changed = false;
+	}
 	m_lightLinksDirty = false;
 	m_lightFilterLinksDirty = false;
 }
@@ -920,36 +931,51 @@ void LightLinks::outputLightLinks( const ScenePlug *scene, const IECore::Compoun
 	const std::string linkedLightsExpression = linkedLightsExpressionData ? linkedLightsExpressionData->readable() : "defaultLights";
 	const std::string linkedShadowsExpression = linkedShadowsExpressionData ? linkedShadowsExpressionData->readable() : "__lights";
 
+	bool relinkAll = true;
 	if( hash )
 	{
 		IECore::MurmurHash h;
 		h.append( linkedLightsExpression );
 		h.append( linkedShadowsExpression );
-		if( !m_lightLinksDirty && *hash == h )
+		if( *hash == h )
 		{
-			// We're only being called because the attributes have changed as a whole, but the
-			// specific attributes we care about haven't changed. No need to relink anything.
-			/// \todo Investigate other optimisations. Perhaps `setExpressionHash()` is fast enough
-			/// that we could use it to avoid editing links when sets have been dirtied but the
-			/// specific sets we care about haven't changed?
-			return;
+			if( !m_lightLinksDirty )
+			{
+				// We're only being called because the attributes have changed as a whole, but the
+				// specific attributes we care about haven't changed. No need to relink anything.
+				return;
+			}
+			// The sets have been dirtied, but we only need to relink if that has
+			// changed the lights matched by our expressions.
+			relinkAll = false;
 		}
 		*hash = h;
 	}
 
-	IECoreScenePreview::Renderer::ConstObjectSetPtr objectSet = linkedLights( linkedLightsExpression, scene );
-	object->link( g_lights, objectSet );
-	objectSet = linkedLights( linkedShadowsExpression, scene );
-	object->link( g_shadowGroupAttributeName, objectSet );
+	bool changed = true;
+	IECoreScenePreview::Renderer::ConstObjectSetPtr objectSet = linkedLights( linkedLightsExpression, scene, &changed );
+	if( relinkAll || changed )
+	{
+		object->link( g_lights, objectSet );
+	}
+	objectSet = linkedLights( linkedShadowsExpression, scene, &changed );
+	if( relinkAll || changed )
+	{
+		object->link( g_shadowGroupAttributeName, objectSet );
+	}
 }
 
-IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene ) const
+IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const std::string &linkedLightsExpression, const ScenePlug *scene, bool *changed ) const
 {
 	LightLinkMap::accessor a;
-	if( !m_lightLinks.insert( a, linkedLightsExpression ) )
+	if( !m_lightLinks.insert( a, linkedLightsExpression ) && !a->second.dirty )
 	{
 		// Already did the work
-		return a->second;
+		if( changed )
+		{
+			*changed = a->second.changed;
+		}
+		return a->second.objectSet;
 	}
 
 	PathMatcher paths = SetAlgo::evaluateSetExpression( linkedLightsExpression, scene );
@@ -972,8 +998,32 @@ IECoreScenePreview::Renderer::ConstObjectSetPtr LightLinks::linkedLights( const
 		objectSet = nullptr;
 	}
 
-	a->second = objectSet;
-	return a->second;
+	if( a->second.dirty )
+	{
+		// Recomputing after the sets were dirtied. Keep the previous
+		// ObjectSet if it is equivalent, so that we don't need to relink.
+		a->second.dirty = false;
+		const bool equivalent =
+			( !objectSet && !a->second.objectSet ) ||
+			( objectSet && a->second.objectSet && *objectSet == *a->second.objectSet )
+		;
+		if( !equivalent )
+		{
+			a->second.objectSet = objectSet;
+			a->second.changed = true;
+		}
+	}
+	else
+	{
+		a->second.objectSet = objectSet;
+		a->second.changed = true;
+	}
+
+	if( changed )
+	{
+		*changed = a->second.changed;
+	}
+	return a->second.objectSet;
 }
 
 void LightLinks::outputLightFilterLinks( const ScenePlug *scene )
@@ -1479,82 +1529,212 @@ struct LightFiltersOutput : public LocationOutput
 
 };
 
+// Tracks the locations using each object, so that objects can be released
+// from the cache once the last of them has been visited. Keyed by object
+// hash.
+struct ObjectUser
+{
+	// Number of locations that have been counted but not yet visited.
+	size_t pending = 0;
+	// The times at which a location computed the object. Empty if
+	// no location has computed it.
+	std::vector<float> sampleTimes;
+};
+using ObjectUsers = tbb::concurrent_hash_map<IECore::MurmurHash, ObjectUser>;
+
 struct ObjectOutput : public LocationOutput
 {
 
-	ObjectOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene )
-		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks )
+	ObjectOutput( IECoreScenePreview::Renderer *renderer, const GafferScene::Private::RendererAlgo::RenderOptions &renderOptions, const GafferScene::Private::RendererAlgo::RenderSets &renderSets, const GafferScene::Private::RendererAlgo::LightLinks *lightLinks, const ScenePlug::ScenePath &root, const ScenePlug *scene, ObjectUsers *objectUsers )
+		:	LocationOutput( renderer, renderOptions, renderSets, root, scene ), m_cameraSet( renderSets.camerasSet() ), m_lightSet( renderSets.lightsSet() ), m_lightFiltersSet( renderSets.lightFiltersSet() ), m_lightLinks( lightLinks ), m_objectUsers( objectUsers )
 	{
 	}
 
 	bool operator()( const ScenePlug *scene, const ScenePlug::ScenePath &path )
 	{
-		if( !LocationOutput::operator()( scene, path ) )
+		if( !m_objectUsers )
 		{
-			return false;
+			return outputObject( scene, path );
 		}
 
-		if( ( m_cameraSet.match( path ) & IECore::PathMatcher::ExactMatch ) || ( m_lightFiltersSet.match( path ) & IECore::PathMatcher::ExactMatch ) || ( m_lightSet.match( path ) & IECore::PathMatcher::ExactMatch ) )
-		{
-			return true;
-		}
+		// Every location visited must release its use of the object, whether
+		// or not it outputs it. Otherwise objects shared with cameras, lights,
+		// excluded purposes or invisible locations would never be released.
+		// We count the users for our children before returning, so that
+		// the counts are in place before any of them can be visited. Counting
+		// one level ahead like this means that an object shared between
+		// distant parts of the hierarchy may occasionally be released and
+		// recomputed, but objects shared between siblings, as generated by
+		// Duplicate and Instancer, are computed only once.
 
-		if( !purposeIncluded() )
+		const IECore::MurmurHash objectHash = scene->objectPlug()->hash();
+		vector<float> sampleTimes;
+		const bool result = outputObject( scene, path, &sampleTimes );
+		releaseObject( scene, objectHash, sampleTimes );
+		if( result )
 		{
-			return true;
+			countChildUsers( scene, path );
 		}
+		return result;
+	}
 
-		vector<float> sampleTimes;
-		deformationMotionTimes( sampleTimes );
+	const PathMatcher &m_cameraSet;
+	const PathMatcher &m_lightSet;
+	const PathMatcher &m_lightFiltersSet;
+	const GafferScene::Private::RendererAlgo::LightLinks *m_lightLinks;
+	ObjectUsers *m_objectUsers;
 
-		vector<ConstObjectPtr> samples;
-		GafferScene::Private::RendererAlgo::objectSamples( scene->objectPlug(), sampleTimes, samples );
-		if( !samples.size() )
-		{
-			return true;
-		}
+	private :
 
-		IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
-		IECoreScenePreview::Renderer::AttributesInterfacePtr attributesInterface = this->attributesInterface();
-		if( samples.size() == 1 )
+		// Outputs the object at the current location, returning true if the
+		// children should be visited. If `computedSampleTimes` is passed, it is
+		// filled with the times the object was computed at, if it was computed.
+		bool outputObject( const ScenePlug *scene, const ScenePlug::ScenePath &path, vector<float> *computedSampleTimes = nullptr )
 		{
-			ConstObjectPtr sample = samples[0];
-			if( auto capsule = runTimeCast<const Capsule>( sample.get() ) )
+			if( !LocationOutput::operator()( scene, path ) )
+			{
+				return false;
+			}
+
+			if( ( m_cameraSet.match( path ) & IECore::PathMatcher::ExactMatch ) || ( m_lightFiltersSet.match( path ) & IECore::PathMatcher::ExactMatch ) || ( m_lightSet.match( path ) & IECore::PathMatcher::ExactMatch ) )
+			{
+				return true;
+			}
+
+			if( !purposeIncluded() )
+			{
+				return true;
+			}
+
+			vector<float> sampleTimes;
+			deformationMotionTimes( sampleTimes );
+
+			vector<ConstObjectPtr> samples;
+			GafferScene::Private::RendererAlgo::objectSamples( scene->objectPlug(), sampleTimes, samples );
+			if( computedSampleTimes )
 			{
-				CapsulePtr capsuleCopy = capsule->copy();
-				capsuleCopy->setRenderOptions( renderOptions() );
-				sample = capsuleCopy;
+				*computedSampleTimes = sampleTimes;
+				if( sampleTimes.empty() )
+				{
+					// Computed at the current time.
+					computedSampleTimes->push_back( Context::current()->getFrame() );
+				}
+			}
+
+			if( !samples.size() )
+			{
+				return true;
 			}
-			objectInterface = renderer()->object( name( path ), sample.get(), attributesInterface.get() );
+
+			IECoreScenePreview::Renderer::ObjectInterfacePtr objectInterface;
+			IECoreScenePreview::Renderer::AttributesInterfacePtr attributesInterface = this->attributesInterface();
+			if( samples.size() == 1 )
+			{
+				ConstObjectPtr sample = samples[0];
+				if( auto capsule = runTimeCast<const Capsule>( sample.get() ) )
+				{
+					CapsulePtr capsuleCopy = capsule->copy();
+					capsuleCopy->setRenderOptions( renderOptions() );
+					sample = capsuleCopy;
+				}
+				objectInterface = renderer()->object( name( path ), sample.get(), attributesInterface.get() );
+			}
+			else
+			{
+				assert( sampleTimes.size() == samples.size() );
+				/// \todo Can we rejig things so this conversion isn't necessary?
+				vector<const Object *> objectsVector; objectsVector.reserve( samples.size() );
+				for( const auto &sample : samples )
+				{
+					objectsVector.push_back( sample.get() );
+				}
+				objectInterface = renderer()->object( name( path ), objectsVector, sampleTimes, attributesInterface.get() );
+			}
+
+			if( objectInterface )
+			{
+				applyTransform( objectInterface.get() );
+				if( m_lightLinks )
+				{
+					m_lightLinks->outputLightLinks( scene, attributes(), objectInterface.get() );
+				}
+			}
+
+			return true;
 		}
-		else
+
+		// Adds a pending use of the object at each child of the current
+		// location.
+		void countChildUsers( const ScenePlug *scene, const ScenePlug::ScenePath &path )
 		{
-			assert( sampleTimes.size() == samples.size() );
-			/// \todo Can we rejig things so this conversion isn't necessary?
-			vector<const Object *> objectsVector; objectsVector.reserve( samples.size() );
-			for( const auto &sample : samples )
+			IECore::ConstInternedStringVectorDataPtr childNamesData = scene->childNamesPlug()->getValue();
+			const std::vector<IECore::InternedString> &childNames = childNamesData->readable();
+			if( childNames.empty() )
 			{
-				objectsVector.push_back( sample.get() );
+				return;
 			}
-			objectInterface = renderer()->object( name( path ), objectsVector, sampleTimes, attributesInterface.get() );
+
+			const ThreadState &threadState = ThreadState::current();
+			tbb::parallel_for(
+				tbb::blocked_range<size_t>( 0, childNames.size() ),
+				[&] ( const tbb::blocked_range<size_t> &range ) {
+					ScenePlug::ScenePath childPath = path;
+					childPath.push_back( IECore::InternedString() );
+					ScenePlug::PathScope pathScope( threadState );
+					for( size_t i = range.begin(); i != range.end(); ++i )
+					{
+						childPath.back() = childNames[i];
+						pathScope.setPath( &childPath );
+						ObjectUsers::accessor users;
+						m_objectUsers->insert( users, scene->objectPlug()->hash() );
+						users->second.pending++;
+					}
+				}
+			);
 		}
 
-		if( objectInterface )
+		// Releases this location's use of the object, removing it from the
+		// cache if this was the last use. The renderer has already taken what
+		// it needs from the object, and because the traversal only has a few
+		// locations in flight at once, this bounds the memory used by objects.
+		void releaseObject( const ScenePlug *scene, const IECore::MurmurHash &objectHash, const vector<float> &sampleTimes )
 		{
-			applyTransform( objectInterface.get() );
-			if( m_lightLinks )
+			vector<float> timesToRelease;
 			{
-				m_lightLinks->outputLightLinks( scene, attributes(), objectInterface.get() );
+				ObjectUsers::accessor users;
+				if( !m_objectUsers->find( users, objectHash ) )
+				{
+					// The root of the traversal isn't counted by a parent,
+					// so is the only user.
+					timesToRelease = sampleTimes;
+				}
+				else
+				{
+					if( users->second.sampleTimes.empty() )
+					{
+						users->second.sampleTimes = sampleTimes;
+					}
+					if( --users->second.pending )
+					{
+						return;
+					}
+					timesToRelease.swap( users->second.sampleTimes );
+					m_objectUsers->erase( users );
+				}
 			}
-		}
 
-		return true;
-	}
+			if( timesToRelease.empty() )
+			{
+				return;
+			}
 
-	const PathMatcher &m_cameraSet;
-	const PathMatcher &m_lightSet;
-	const PathMatcher &m_lightFiltersSet;
-	const GafferScene::Private::RendererAlgo::LightLinks *m_lightLinks;
+			Context::EditableScope timeContext( Context::current() );
+			for( const float sampleTime : timesToRelease )
+			{
+				timeContext.setFrame( sampleTime );
+				scene->objectPlug()->removeCachedValue();
+			}
+		}
 
 };
 
@@ -1813,9 +1993,12 @@ void outputLights( const ScenePlug *scene, const RenderOptions &renderOptions, c
 	SceneAlgo::parallelProcessLocations( scene, output );
 }
 
-void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root )
+void outputObjects( const ScenePlug *scene, const RenderOptions &renderOptions, const RenderSets &renderSets, const LightLinks *lightLinks, IECoreScenePreview::Renderer *renderer, const ScenePlug::ScenePath &root, bool releaseObjects )
 {
-	ObjectOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene );
+	// When releasing objects, `ObjectOutput` counts the users of each object
+	// as it goes, so that it can tell when an object is no longer needed.
+	ObjectUsers objectUsers;
+	ObjectOutput output( renderer, renderOptions, renderSets, lightLinks, root, scene, releaseObjects ? &objectUsers : nullptr );
 	SceneAlgo::parallelProcessLocations( scene, output, root );
 }
 
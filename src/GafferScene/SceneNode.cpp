@@ -54,6 +54,14 @@ using namespace IECore;
 using namespace GafferScene;
 using namespace Gaffer;
 
+namespace
+{
+
+const InternedString g_objectCachePartition( "scene.object" );
+const InternedString g_setCachePartition( "scene.set" );
+
+} // namespace
+
 GAFFER_NODE_DEFINE_TYPE( SceneNode );
 
 size_t SceneNode::g_firstPlugIndex = 0;
@@ -438,6 +446,23 @@ Gaffer::ValuePlug::CachePolicy SceneNode::computeCachePolicy( const Gaffer::Valu
 	return ComputeNode::computeCachePolicy( output );
 }
 
+IECore::InternedString SceneNode::computeCachePartition( const Gaffer::ValuePlug *output ) const
+{
+	if( auto parent = output->parent<ScenePlug>() )
+	{
+		if( output == parent->objectPlug() )
+		{
+			return g_objectCachePartition;
+		}
+		else if( output == parent->setPlug() )
+		{
+			return g_setCachePartition;
+		}
+	}
+
+	return ComputeNode::computeCachePartition( output );
+}
+
 IECore::MurmurHash SceneNode::hashOfTransformedChildBounds( const ScenePath &path, const ScenePlug *out, const IECore::InternedStringVectorData *childNamesData ) const
 {
 	ScenePlug::PathScope pathScope( Context::current(), &path );
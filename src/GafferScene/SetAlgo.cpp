@@ -40,6 +40,8 @@
 
 #include "GafferScene/SetAlgo.h"
 
+#include "Gaffer/Private/IECorePreview/LRUCache.h"
+
 #include "IECore/MessageHandler.h"
 
 #include "boost/algorithm/string/predicate.hpp"
@@ -53,6 +55,8 @@
 
 #include "fmt/format.h"
 
+#include <unordered_map>
+
 using namespace IECore;
 using namespace Gaffer;
 using namespace GafferScene;
@@ -172,12 +176,29 @@ std::ostream& operator<<( std::ostream& stream, const ExpressionAst& expr )
 
 // Evaluating the AST
 // ------------------
+
+// Hashes for each BinaryOp in an AST, used to memoise their results.
+using NodeHashes = std::unordered_map<const BinaryOp *, IECore::MurmurHash>;
+
+// Intermediate results are shared between all expressions, so that common
+// subexpressions such as `defaultLights - ( A | B )` are only evaluated once
+// when they appear in many expressions. PathMatcher copies share their
+// internal storage, so copying results out of the cache is cheap. Cost is
+// measured in paths, plus one for the result itself so that empty results
+// still count towards the limit. The cache is cleared along with the
+// compute cache.
+using ResultCache = IECorePreview::LRUCache<IECore::MurmurHash, PathMatcher, IECorePreview::LRUCachePolicy::Parallel>;
+ResultCache g_resultCache( ResultCache::GetterFunction(), 10000000 );
+const Signals::Connection g_resultCacheClearedConnection = ValuePlug::cacheClearedSignal().connect(
+	[] { g_resultCache.clear(); }
+);
+
 struct AstEvaluator
 {
 	using result_type = PathMatcher;
 
-	AstEvaluator( const ScenePlug *scene )
-		: m_scene( scene )
+	AstEvaluator( const ScenePlug *scene, const NodeHashes *nodeHashes = nullptr )
+		: m_scene( scene ), m_nodeHashes( nodeHashes )
 	{
 	}
 
@@ -235,17 +256,41 @@ struct AstEvaluator
 	}
 
 	result_type operator()( const BinaryOp &expr ) const
+	{
+		const IECore::MurmurHash *hash = nullptr;
+		if( m_nodeHashes )
+		{
+			auto it = m_nodeHashes->find( &expr );
+			if( it != m_nodeHashes->end() )
+			{
+				hash = &it->second;
+				if( auto cachedResult = g_resultCache.getIfCached( *hash ) )
+				{
+					return *cachedResult;
+				}
+			}
+		}
+
+		PathMatcher result = evaluate( expr );
+		if( hash )
+		{
+			g_resultCache.set( *hash, result, 1 + result.size() );
+		}
+		return result;
+	}
+
+	PathMatcher evaluate( const BinaryOp &expr ) const
 	{
 		PathMatcher left = boost::apply_visitor( *this, expr.left );
 		PathMatcher right = boost::apply_visitor( *this, expr.right );
 
+		// We own `left` and `right`, so can modify them in place.
 		switch( expr.op )
 		{
 			case Union :
 			{
-				PathMatcher result = PathMatcher( left );
-				result.addPaths( right );
-				return result;
+				left.addPaths( right );
+				return left;
 			}
 			case Intersection :
 			{
@@ -253,9 +298,8 @@ struct AstEvaluator
 			}
 			case Difference :
 			{
-				PathMatcher result = PathMatcher( left );
-				result.removePaths( right );
-				return result;
+				left.removePaths( right );
+				return left;
 			}
 			case In :
 			{
@@ -285,6 +329,7 @@ struct AstEvaluator
 	}
 
 	const ScenePlug *m_scene;
+	const NodeHashes *m_nodeHashes;
 
 };
 
@@ -356,6 +401,44 @@ struct AstHasher
 
 };
 
+// Computes a hash for every BinaryOp in an AST in a single pass, so that
+// AstEvaluator can look up memoised results without rehashing subtrees.
+struct AstNodeHasher
+{
+	using result_type = IECore::MurmurHash;
+
+	AstNodeHasher( const ScenePlug *scene, NodeHashes &nodeHashes ) : m_scene( scene ), m_nodeHashes( nodeHashes )
+	{
+	}
+
+	IECore::MurmurHash operator()( const std::string &identifier )
+	{
+		IECore::MurmurHash h;
+		AstHasher hasher( m_scene, h );
+		hasher( identifier );
+		return h;
+	}
+
+	IECore::MurmurHash operator()( const BinaryOp &expr )
+	{
+		IECore::MurmurHash h;
+		h.append( expr.op );
+		h.append( boost::apply_visitor( *this, expr.left ) );
+		h.append( boost::apply_visitor( *this, expr.right ) );
+		m_nodeHashes[&expr] = h;
+		return h;
+	}
+
+	IECore::MurmurHash operator()( const Nil &nil )
+	{
+		return IECore::MurmurHash();
+	}
+
+	const ScenePlug* m_scene;
+	NodeHashes &m_nodeHashes;
+
+};
+
 template <typename Iterator>
 struct ExpressionGrammar : qi::grammar<Iterator, ExpressionAst(), ascii::space_type>
 {
@@ -482,6 +565,22 @@ void expressionToAST( const std::string &setExpression, ExpressionAst &ast)
 	}
 }
 
+// Parsing is relatively expensive, and the same expressions are evaluated
+// and hashed repeatedly, so we cache the ASTs. Errors are cached too, so that
+// invalid expressions fail quickly. Cost is measured in entries.
+using ConstExpressionAstPtr = std::shared_ptr<const ExpressionAst>;
+
+ConstExpressionAstPtr astGetter( const std::string &setExpression, size_t &cost, const IECore::Canceller *canceller )
+{
+	cost = 1;
+	auto ast = std::make_shared<ExpressionAst>();
+	expressionToAST( setExpression, *ast );
+	return ast;
+}
+
+using AstCache = IECorePreview::LRUCache<std::string, ConstExpressionAstPtr, IECorePreview::LRUCachePolicy::Parallel>;
+AstCache g_astCache( astGetter, 10000 );
+
 } // namespace
 
 namespace GafferScene
@@ -492,18 +591,24 @@ namespace SetAlgo
 
 PathMatcher evaluateSetExpression( const std::string &setExpression, const ScenePlug *scene )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
-	return boost::apply_visitor( AstEvaluator( scene ), ast );
+	ConstExpressionAstPtr ast = g_astCache.get( setExpression );
+	if( !scene || !boost::get<BinaryOp>( ast.get() ) )
+	{
+		// No operators, so nothing to memoise.
+		return boost::apply_visitor( AstEvaluator( scene ), *ast );
+	}
+
+	NodeHashes nodeHashes;
+	AstNodeHasher hasher( scene, nodeHashes );
+	boost::apply_visitor( hasher, *ast );
+	return boost::apply_visitor( AstEvaluator( scene, &nodeHashes ), *ast );
 }
 
 void setExpressionHash( const std::string &setExpression, const ScenePlug* scene, IECore::MurmurHash &h )
 {
-	ExpressionAst ast;
-	expressionToAST( setExpression, ast );
-
+	ConstExpressionAstPtr ast = g_astCache.get( setExpression );
 	AstHasher hasher = AstHasher( scene, h );
-	boost::apply_visitor( hasher, ast );
+	boost::apply_visitor( hasher, *ast );
 }
 
 IECore::MurmurHash setExpressionHash( const std::string &setExpression, const ScenePlug* scene)
@@ -525,6 +630,21 @@ bool affectsSetExpression( const Plug *scenePlugChild )
 	return false;
 }
 
+void setExpressionResultCacheLimit( size_t limit )
+{
+	g_resultCache.setMaxCost( limit );
+}
+
+size_t getExpressionResultCacheLimit()
+{
+	return g_resultCache.getMaxCost();
+}
+
+size_t expressionResultCacheUsage()
+{
+	return g_resultCache.currentCost();
+}
+
 } // namespace SetAlgo
 
 } // namespace Gaffer
@@ -53,6 +53,7 @@
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 #include "GafferScene/Private/IECoreScenePreview/MeshAlgo.h"
 #include "GafferScene/Private/IECoreScenePreview/PrimitiveAlgo.h"
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
 
 using namespace IECoreScenePreview;
 using namespace boost::python;
@@ -392,6 +393,34 @@ IECoreScene::PrimitivePtr mergePrimitivesWrapper( object primitives, const IECor
 	return PrimitiveAlgo::mergePrimitives( typedPrimitives, canceller );
 }
 
+IECore::ObjectPtr translationCacheGetWrapper( const IECore::MurmurHash &key, object translator )
+{
+	IECore::ConstObjectPtr result;
+	{
+		IECorePython::ScopedGILRelease gilRelease;
+		result = TranslationCache::get(
+			key,
+			[&translator] () -> IECore::ConstObjectPtr {
+				IECorePython::ScopedGILLock gilLock;
+				return extract<IECore::ObjectPtr>( translator() )();
+			}
+		);
+	}
+	// Copy, because the cached result must not be modified from Python.
+	return result ? result->copy() : nullptr;
+}
+
+IECore::MurmurHash translationCacheSamplesHash( object pythonSamples, object pythonTimes )
+{
+	std::vector<const IECore::Object *> samples;
+	container_utils::extend_container( samples, pythonSamples );
+
+	std::vector<float> times;
+	container_utils::extend_container( times, pythonTimes );
+
+	return TranslationCache::samplesHash( samples, times );
+}
+
 } // namespace
 
 void GafferSceneModule::bindIECoreScenePreview()
@@ -516,6 +545,7 @@ void GafferSceneModule::bindIECoreScenePreview()
 				arg( "interpolateBoundary" ) = "",
 				arg( "faceVaryingLinearInterpolation" ) = "",
 				arg( "triangleSubdivisionRule" ) = "",
+				arg( "maxEdgeLength" ) = 0.0f,
 				arg( "canceller" ) = object()
 			)
 		);
@@ -525,6 +555,7 @@ void GafferSceneModule::bindIECoreScenePreview()
 		.def( init<Renderer::RenderType, const std::string &, const IECore::MessageHandlerPtr &>( ( arg( "renderType" ) = Renderer::RenderType::Interactive, arg( "fileName" ) = "", arg( "messageHandler") = IECore::MessageHandlerPtr() ) ) )
 		.def( "capturedObjectNames", &capturingRendererCapturedObjectNames )
 		.def( "capturedObject", &capturingRendererCapturedObject )
+		.def( "numUniqueObjects", &CapturingRenderer::numUniqueObjects )
 	;
 
 	IECorePython::RefCountedClass<CapturingRenderer::CapturedAttributes, Renderer::AttributesInterface>( "CapturedAttributes" )
@@ -565,4 +596,25 @@ void GafferSceneModule::bindIECoreScenePreview()
 			)
 		);
 	}
+
+	{
+		object translationCacheModule( borrowed( PyImport_AddModule( "GafferScene.Private.IECoreScenePreview.TranslationCache" ) ) );
+		scope().attr( "TranslationCache" ) = translationCacheModule;
+
+		scope translationCacheScope( translationCacheModule );
+
+		def( "get", &translationCacheGetWrapper, ( arg( "key" ), arg( "translator" ) ) );
+		def( "samplesHash", &translationCacheSamplesHash, ( arg( "samples" ), arg( "times" ) ) );
+		def( "setMemoryLimit", &TranslationCache::setMemoryLimit );
+		def( "getMemoryLimit", &TranslationCache::getMemoryLimit );
+		def( "memoryUsage", &TranslationCache::memoryUsage );
+		def( "clear", &TranslationCache::clear );
+		def( "statistics", &TranslationCache::statistics );
+		def( "resetStatistics", &TranslationCache::resetStatistics );
+
+		class_<TranslationCache::Statistics>( "Statistics" )
+			.def_readonly( "hits", &TranslationCache::Statistics::hits )
+			.def_readonly( "misses", &TranslationCache::Statistics::misses )
+		;
+	}
 }
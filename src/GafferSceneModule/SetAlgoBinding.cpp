@@ -95,6 +95,9 @@ void bindSetAlgo()
 	);
 
 	def( "affectsSetExpression", &SetAlgo::affectsSetExpression );
+	def( "setExpressionResultCacheLimit", &SetAlgo::setExpressionResultCacheLimit );
+	def( "getExpressionResultCacheLimit", &SetAlgo::getExpressionResultCacheLimit );
+	def( "expressionResultCacheUsage", &SetAlgo::expressionResultCacheUsage );
 
 }
 
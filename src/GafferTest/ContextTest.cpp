@@ -324,6 +324,62 @@ void GafferTest::testContextCopyPerformance( int numEntries, int entrySize )
 
 }
 
+void GafferTest::testContextSetPerformance()
+{
+	// Representative of the variables set per-location and
+	// per-tile during scene traversals and image processing.
+	// All but the InternedString are small enough to be stored
+	// inline, sharing a single allocation.
+
+	ContextPtr baseContext = new Context();
+	const InternedString intName( "testInt" );
+	const InternedString v2iName( "testV2i" );
+	const InternedString stringName( "testInternedString" );
+	const InternedString value( "value" );
+
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, 1000000 ),
+		[&]( const tbb::blocked_range<int> &r )
+		{
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				Context::EditableScope scope( baseContext.get() );
+				scope.setAllocated( intName, i );
+				scope.setAllocated( v2iName, Imath::V2i( i ) );
+				scope.setAllocated( stringName, value );
+				scope.setFrame( i );
+				GAFFERTEST_ASSERTEQUAL( scope.context()->get<int>( intName ), i );
+				scope.context()->hash();
+			}
+		}
+	);
+}
+
+void GafferTest::testCancellableContextCopyPerformance( int numEntries )
+{
+	// Mirrors the copies made when launching cancellable
+	// background computes from a context populated with
+	// typical small values.
+	ContextPtr baseContext = new Context();
+	for( int i = 0; i < numEntries; i++ )
+	{
+		baseContext->set( InternedString( i ), i );
+	}
+	baseContext->set( "testV2i", Imath::V2i( 1, 2 ) );
+
+	IECore::Canceller canceller;
+	tbb::parallel_for(
+		tbb::blocked_range<int>( 0, 1000000 ),
+		[&baseContext, &canceller]( const tbb::blocked_range<int> &r )
+		{
+			for( int i = r.begin(); i != r.end(); ++i )
+			{
+				ContextPtr copy = new Context( *baseContext, canceller );
+			}
+		}
+	);
+}
+
 void GafferTest::testCopyEditableScope()
 {
 	ContextPtr copy;
@@ -356,15 +412,17 @@ void GafferTest::testCopyEditableScope()
 	GAFFERTEST_ASSERTEQUAL( copy->get<string>( "f" ), "cat" );
 
 	// A second copy should be fairly cheap, just referencing
-	// the same data.
+	// the same data. Ints are small enough to be stored inline,
+	// so they are copied rather than referenced.
 
 	ContextPtr copy2 = new Context( *copy );
-	GAFFERTEST_ASSERTEQUAL( (void *)&copy->get<int>( "a" ), (void *)&copy2->get<int>( "a" ) );
-	GAFFERTEST_ASSERTEQUAL( (void *)&copy->get<int>( "b" ), (void *)&copy2->get<int>( "b" ) );
-	GAFFERTEST_ASSERTEQUAL( (void *)&copy->get<int>( "c" ), (void *)&copy2->get<int>( "c" ) );
-	GAFFERTEST_ASSERTEQUAL( (void *)&copy->get<int>( "d" ), (void *)&copy2->get<int>( "d" ) );
-	GAFFERTEST_ASSERTEQUAL( (void *)&copy->get<int>( "e" ), (void *)&copy2->get<int>( "e" ) );
+	GAFFERTEST_ASSERTEQUAL( copy2->get<int>( "a" ), 10 );
+	GAFFERTEST_ASSERTEQUAL( copy2->get<int>( "b" ), 20 );
+	GAFFERTEST_ASSERTEQUAL( copy2->get<int>( "c" ), 3 );
+	GAFFERTEST_ASSERTEQUAL( copy2->get<int>( "d" ), 10 );
+	GAFFERTEST_ASSERTEQUAL( copy2->get<int>( "e" ), 40 );
 	GAFFERTEST_ASSERTEQUAL( (void *)&copy->get<string>( "f" ), (void *)&copy2->get<string>( "f" ) );
+	GAFFERTEST_ASSERT( copy2->hash() == copy->hash() );
 
 	// And the second copy should still be valid if the first
 	// one is destroyed.
@@ -378,6 +436,91 @@ void GafferTest::testCopyEditableScope()
 	GAFFERTEST_ASSERTEQUAL( copy2->get<string>( "f" ), "cat" );
 }
 
+void GafferTest::testInlineValueReferences()
+{
+	// Small values are stored inline, but references to them
+	// must remain valid as other variables are added.
+
+	ContextPtr context = new Context();
+	context->set( "a", 1 );
+	const int &a = context->get<int>( "a" );
+	const float *frame = context->getIfExists<float>( "frame" );
+
+	for( int i = 0; i < 100; ++i )
+	{
+		context->set( InternedString( i ), i );
+		context->set( "v" + std::to_string( i ), Imath::V2i( i ) );
+	}
+
+	GAFFERTEST_ASSERTEQUAL( a, 1 );
+	GAFFERTEST_ASSERTEQUAL( *frame, 1.0f );
+	GAFFERTEST_ASSERT( &a == &context->get<int>( "a" ) );
+
+	// Setting the variable again reuses the same storage.
+
+	context->set( "a", 2 );
+	GAFFERTEST_ASSERTEQUAL( a, 2 );
+	GAFFERTEST_ASSERT( &a == &context->get<int>( "a" ) );
+
+	// Storage is recycled when variables are removed or
+	// replaced by values of other types.
+
+	for( int i = 0; i < 100; ++i )
+	{
+		context->remove( InternedString( i ) );
+		context->set( "v" + std::to_string( i ), std::string( "s" ) );
+	}
+
+	for( int i = 0; i < 200; ++i )
+	{
+		context->set( InternedString( i ), i );
+	}
+
+	GAFFERTEST_ASSERTEQUAL( a, 2 );
+	GAFFERTEST_ASSERTEQUAL( *frame, 1.0f );
+	for( int i = 0; i < 200; ++i )
+	{
+		GAFFERTEST_ASSERTEQUAL( context->get<int>( InternedString( i ) ), i );
+	}
+
+	// Copies share storage until either context is modified, at which
+	// point the modified value is given storage of its own.
+
+	ContextPtr copy = new Context( *context );
+	GAFFERTEST_ASSERT( &copy->get<int>( "a" ) == &a );
+	context->set( "a", 3 );
+	GAFFERTEST_ASSERTEQUAL( context->get<int>( "a" ), 3 );
+	GAFFERTEST_ASSERTEQUAL( copy->get<int>( "a" ), 2 );
+	GAFFERTEST_ASSERTEQUAL( a, 2 );
+	copy->set( "0", 10 );
+	GAFFERTEST_ASSERTEQUAL( context->get<int>( "0" ), 0 );
+	context->remove( "1" );
+	context->set( "b", 4 );
+	GAFFERTEST_ASSERTEQUAL( copy->get<int>( "1" ), 1 );
+	context.reset();
+	GAFFERTEST_ASSERTEQUAL( copy->get<int>( "0" ), 10 );
+	GAFFERTEST_ASSERTEQUAL( copy->get<int>( "1" ), 1 );
+	GAFFERTEST_ASSERTEQUAL( copy->get<float>( "frame" ), 1.0f );
+
+	// Values set by pointer via an EditableScope are copied, because
+	// the scope doesn't own them.
+
+	float frameStorage = 10.0f;
+	ContextPtr scopeCopy;
+	{
+		Context::EditableScope scope( copy.get() );
+		scope.set( "frame", &frameStorage );
+		scope.setAllocated( "s", InternedString( "s" ) );
+		scopeCopy = new Context( *scope.context() );
+	}
+	frameStorage = 20.0f;
+	GAFFERTEST_ASSERTEQUAL( scopeCopy->get<float>( "frame" ), 10.0f );
+	GAFFERTEST_ASSERT( scopeCopy->get<InternedString>( "s" ) == InternedString( "s" ) );
+	GAFFERTEST_ASSERTEQUAL( scopeCopy->get<int>( "0" ), 10 );
+	GAFFERTEST_ASSERTEQUAL( copy->get<float>( "frame" ), 1.0f );
+	GAFFERTEST_ASSERT( !copy->getIfExists<InternedString>( "s" ) );
+}
+
 void GafferTest::testContextHashValidation()
 {
 	ContextPtr context = new Context();
@@ -106,7 +106,10 @@ BOOST_PYTHON_MODULE( _GafferTest )
 	def( "countContextHash32Collisions", &countContextHash32CollisionsWrapper );
 	def( "testContextHashPerformance", &testContextHashPerformance );
 	def( "testContextCopyPerformance", &testContextCopyPerformance );
+	def( "testContextSetPerformance", &testContextSetPerformance );
+	def( "testCancellableContextCopyPerformance", &testCancellableContextCopyPerformance );
 	def( "testCopyEditableScope", &testCopyEditableScope );
+	def( "testInlineValueReferences", &testInlineValueReferences );
 	def( "testContextHashValidation", &testContextHashValidation );
 	def( "testComputeNodeThreading", &testComputeNodeThreading );
 	def( "testDownstreamIterator", &testDownstreamIterator );
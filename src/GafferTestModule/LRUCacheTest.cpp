@@ -800,6 +800,138 @@ void testLRUCacheSetIfUncached( const std::string &policy )
 	DispatchTest<TestLRUCacheSetIfUncached>()( policy );
 }
 
+template<template<typename> class Policy>
+struct TestLRUCacheStatistics
+{
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+				cost = 1;
+				return key;
+			},
+			10
+		);
+
+		auto statistics = cache.statistics();
+		GAFFERTEST_ASSERTEQUAL( statistics.hits, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.misses, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictions, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictedCost, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.computeDuration.count(), 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.contentionWaits, 0 );
+
+		// Misses, followed by hits.
+
+		GAFFERTEST_ASSERTEQUAL( cache.get( 0 ), 0 );
+		GAFFERTEST_ASSERT( !cache.getIfCached( 1 ) );
+		GAFFERTEST_ASSERTEQUAL( cache.get( 0 ), 0 );
+		GAFFERTEST_ASSERTEQUAL( *cache.getIfCached( 0 ), 0 );
+
+		statistics = cache.statistics();
+		GAFFERTEST_ASSERTEQUAL( statistics.hits, 2 );
+		GAFFERTEST_ASSERTEQUAL( statistics.misses, 2 );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictions, 0 );
+
+		// Clearing doesn't count as eviction.
+
+		cache.clear();
+		GAFFERTEST_ASSERTEQUAL( cache.statistics().evictions, 0 );
+
+		// Exceeding the maximum cost does.
+
+		for( int i = 0; i < 20; ++i )
+		{
+			cache.get( i );
+		}
+
+		statistics = cache.statistics();
+		GAFFERTEST_ASSERTEQUAL( statistics.misses, 22 );
+		GAFFERTEST_ASSERT( statistics.evictions >= 10 );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictedCost, statistics.evictions );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictions + cache.currentCost(), 20 );
+
+		// Resetting.
+
+		cache.resetStatistics();
+		statistics = cache.statistics();
+		GAFFERTEST_ASSERTEQUAL( statistics.hits, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.misses, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictions, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.evictedCost, 0 );
+		GAFFERTEST_ASSERTEQUAL( statistics.computeDuration.count(), 0 );
+	}
+
+};
+
+void testLRUCacheStatistics( const std::string &policy )
+{
+	DispatchTest<TestLRUCacheStatistics>()( policy );
+}
+
+template<template<typename> class Policy>
+struct TestLRUCacheEvictionMode
+{
+
+	void operator()()
+	{
+		using Cache = IECorePreview::LRUCache<int, int, Policy>;
+
+		Cache cache(
+			[]( int key, size_t &cost, const IECore::Canceller *canceller ) {
+				cost = 1;
+				return key;
+			},
+			10
+		);
+		GAFFERTEST_ASSERT( cache.getEvictionMode() == Cache::EvictionMode::LRU );
+
+		// In LRU mode, an expensive item is evicted as
+		// readily as any other.
+
+		cache.set( 0, 0, 1, std::chrono::seconds( 1 ) );
+		for( int i = 1; i <= 20; ++i )
+		{
+			cache.set( i, i, 1 );
+		}
+		GAFFERTEST_ASSERT( !cache.cached( 0 ) );
+
+		// In CostAware mode, it survives much longer than
+		// the cheap items.
+
+		cache.clear();
+		cache.setEvictionMode( Cache::EvictionMode::CostAware );
+		GAFFERTEST_ASSERT( cache.getEvictionMode() == Cache::EvictionMode::CostAware );
+
+		cache.set( 0, 0, 1, std::chrono::seconds( 1 ) );
+		for( int i = 1; i <= 20; ++i )
+		{
+			cache.set( i, i, 1 );
+		}
+		GAFFERTEST_ASSERT( cache.cached( 0 ) );
+		GAFFERTEST_ASSERT( !cache.cached( 1 ) );
+
+		// But it is still evicted eventually if it
+		// isn't used.
+
+		for( int i = 21; i <= 1000; ++i )
+		{
+			cache.set( i, i, 1 );
+		}
+		GAFFERTEST_ASSERT( !cache.cached( 0 ) );
+		GAFFERTEST_ASSERT( cache.currentCost() <= 10 );
+	}
+
+};
+
+void testLRUCacheEvictionMode( const std::string &policy )
+{
+	DispatchTest<TestLRUCacheEvictionMode>()( policy );
+}
+
 } // namespace
 
 void GafferTestModule::bindLRUCacheTest()
@@ -815,4 +947,6 @@ void GafferTestModule::bindLRUCacheTest()
 	def( "testLRUCacheUncacheableItem", &testLRUCacheUncacheableItem );
 	def( "testLRUCacheGetIfCached", &testLRUCacheGetIfCached );
 	def( "testLRUCacheSetIfUncached", &testLRUCacheSetIfUncached );
+	def( "testLRUCacheStatistics", &testLRUCacheStatistics );
+	def( "testLRUCacheEvictionMode", &testLRUCacheEvictionMode );
 }
@@ -36,6 +36,7 @@
 
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
 #include "GafferScene/Private/IECoreScenePreview/Procedural.h"
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
 
 #include "IECoreArnold/CameraAlgo.h"
 #include "IECoreArnold/NodeAlgo.h"
@@ -2231,15 +2232,7 @@ class InstanceCache : public IECore::RefCounted
 				return Instance( convert( samples, times, arnoldAttributes, nodeName, /* messageContext = */ nodeName ) );
 			}
 
-			IECore::MurmurHash h;
-			for( std::vector<const IECore::Object *>::const_iterator it = samples.begin(), eIt = samples.end(); it != eIt; ++it )
-			{
-				(*it)->hash( h );
-			}
-			for( std::vector<float>::const_iterator it = times.begin(), eIt = times.end(); it != eIt; ++it )
-			{
-				h.append( *it );
-			}
+			IECore::MurmurHash h = IECoreScenePreview::TranslationCache::samplesHash( samples, times );
 			arnoldAttributes->hashGeometry( samples.front(), h );
 
 			SharedAtNodePtr node;
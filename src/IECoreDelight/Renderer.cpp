@@ -35,6 +35,7 @@
 //////////////////////////////////////////////////////////////////////////
 
 #include "GafferScene/Private/IECoreScenePreview/Renderer.h"
+#include "GafferScene/Private/IECoreScenePreview/TranslationCache.h"
 
 #include "Gaffer/Private/IECorePreview/LRUCache.h"
 
@@ -935,15 +936,7 @@ class InstanceCache : public IECore::RefCounted
 		// Can be called concurrently with other get() calls.
 		DelightHandleSharedPtr get( const std::vector<const IECore::Object *> &samples, const std::vector<float> &times )
 		{
-			IECore::MurmurHash hash;
-			for( std::vector<const IECore::Object *>::const_iterator it = samples.begin(), eIt = samples.end(); it != eIt; ++it )
-			{
-				(*it)->hash( hash );
-			}
-			for( std::vector<float>::const_iterator it = times.begin(), eIt = times.end(); it != eIt; ++it )
-			{
-				hash.append( *it );
-			}
+			const IECore::MurmurHash hash = IECoreScenePreview::TranslationCache::samplesHash( samples, times );
 
 			Cache::accessor a;
 			m_cache.insert( a, hash );
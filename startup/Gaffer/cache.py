@@ -34,6 +34,7 @@
 #
 ##########################################################################
 
+import os
 import psutil
 
 import Gaffer
@@ -44,3 +45,15 @@ import Gaffer
 Gaffer.ValuePlug.setCacheMemoryLimit(
 	min( 1024**3 * 8, psutil.virtual_memory().total * 3 // 4 )
 )
+
+# Enable the disk cache if a directory has been provided.
+
+if os.environ.get( "GAFFER_DISK_CACHE_DIRECTORY" ) :
+	Gaffer.ValuePlug.setDiskCacheDirectory( os.environ["GAFFER_DISK_CACHE_DIRECTORY"] )
+
+# Choose the cache eviction mode, if one has been provided.
+
+if os.environ.get( "GAFFER_CACHE_EVICTION_MODE" ) :
+	Gaffer.ValuePlug.setCacheEvictionMode(
+		getattr( Gaffer.ValuePlug.CacheEvictionMode, os.environ["GAFFER_CACHE_EVICTION_MODE"] )
+	)
@@ -40,6 +40,7 @@ import IECore
 
 import Gaffer
 import GafferUI
+import GafferScene
 
 menu = GafferUI.ScriptWindow.menuDefinition( application )
 
@@ -125,10 +126,50 @@ def __clearContextMonitor( menu ) :
 	del script.__contextMonitor
 	Gaffer.MonitorAlgo.removeContextAnnotations( script )
 
+def __memoryMonitor( menu, createIfMissing = False ) :
+
+	script = menu.ancestor( GafferUI.ScriptWindow ).scriptNode()
+	monitor = getattr( script, "__memoryMonitor", None )
+	if monitor is not None :
+		return monitor
+
+	if createIfMissing :
+		monitor = Gaffer.MemoryMonitor()
+		monitor.__running = False
+		script.__memoryMonitor = monitor
+		return monitor
+	else :
+		return None
+
+def __startMemoryMonitor( menu ) :
+
+	monitor = __memoryMonitor( menu, createIfMissing = True )
+	assert( not monitor.__running )
+
+	monitor.__enter__()
+	monitor.__running = True
+
+def __stopMemoryMonitor( menu ) :
+
+	monitor = __memoryMonitor( menu )
+	assert( monitor is not None and monitor.__running )
+	monitor.__exit__( None, None, None )
+	monitor.__running = False
+
+	script = menu.ancestor( GafferUI.ScriptWindow ).scriptNode()
+	Gaffer.MonitorAlgo.annotate( script, monitor, persistent = False )
+
+def __clearMemoryMonitor( menu ) :
+
+	script = menu.ancestor( GafferUI.ScriptWindow ).scriptNode()
+	del script.__memoryMonitor
+	Gaffer.MonitorAlgo.removeMemoryAnnotations( script )
+
 def __clearCaches( menu ) :
 
 	Gaffer.ValuePlug.clearCache()
 	Gaffer.ValuePlug.clearHashCache()
+	GafferScene.Private.IECoreScenePreview.TranslationCache.clear()
 
 def __profilingSubMenu( menu ) :
 
@@ -217,6 +258,39 @@ def __profilingSubMenu( menu ) :
 		}
 	)
 
+	# MemoryMonitor
+
+	memoryMonitor = __memoryMonitor( menu )
+
+	result.append(
+		"/Memory Monitor/" + ( "Start" if memoryMonitor is None else "Resume" ),
+		{
+			"command" : __startMemoryMonitor,
+			"active" : memoryMonitor is None or not memoryMonitor.__running
+		}
+	)
+
+	result.append(
+		"/Memory Monitor/Stop and Annotate",
+		{
+			"command" : __stopMemoryMonitor,
+			"active" : memoryMonitor is not None and memoryMonitor.__running
+		}
+	)
+	result.append(
+		"/Memory Monitor/Divider",
+		{
+			"divider" : True,
+		}
+	)
+	result.append(
+		"/Memory Monitor/Clear",
+		{
+			"command" : __clearMemoryMonitor,
+			"active" : memoryMonitor is not None and not memoryMonitor.__running
+		}
+	)
+
 	result.append(
 		"/CacheDivider", { "divider" : True },
 	)
@@ -249,6 +323,9 @@ def __graphEditorCreated( graphEditor ) :
 		"performanceMonitor:perHashDuration",
 		"performanceMonitor:perComputeDuration",
 		"performanceMonitor:hashesPerCompute",
+		"memoryMonitor:hashCacheEntries",
+		"memoryMonitor:computeMemory",
+		"memoryMonitor:peakComputeMemory",
 	}
 
 	annotationsGadget.setVisibleAnnotations( " ".join( visibleAnnotations ) )